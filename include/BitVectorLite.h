@@ -0,0 +1,576 @@
+#pragma once
+
+#include "Vector.h"
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VECTORLITE_TARGET_AVX2
+#elif (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define VECTORLITE_POPCOUNT_DISPATCH 1 // AVX2 / popcnt kernels picked at runtime
+#define VECTORLITE_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#endif
+
+/*
+ * Packed vector of flags, 64 per word, on top of VectorLite<uint64_t>.
+ * Invariant: bits past size() in the last word are always zero, so count(),
+ * the bulk operators and operator== can work a whole word at a time.
+ */
+class BitVectorLite
+{
+    public:
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        BitVectorLite();
+        BitVectorLite(size_t count, bool value);
+        BitVectorLite(std::initializer_list<bool> list);
+
+        /* RULE OF FIVE */
+        ~BitVectorLite() = default;
+
+        BitVectorLite(const BitVectorLite& other) = default; //Copy Constructor
+        BitVectorLite(BitVectorLite&& other) noexcept; //Move constructor
+
+        BitVectorLite& operator=(const BitVectorLite& rhs); //Copy assign
+        BitVectorLite& operator=(BitVectorLite&& rhs) noexcept; //Move assign
+
+        /* Stands in for bool& since single bits are not addressable */
+        class reference {
+            private:
+                uint64_t* word;
+                uint64_t mask;
+            public:
+                reference(uint64_t* w, uint64_t m) : word(w), mask(m) {}
+
+                operator bool() const { return (*word & mask) != 0; }
+                reference& operator=(bool value)
+                {
+                    if (value)
+                        *word |= mask;
+                    else
+                        *word &= ~mask;
+                    return *this;
+                }
+                reference& operator=(const reference& other) { return *this = static_cast<bool>(other); }
+                void flip() { *word ^= mask; }
+        };
+
+        void push_back(bool value);
+        void pop_back();
+
+        void pop(); // Exception Defined version of pop_back
+
+        reference at(size_t index); // throws std::out_of_range if out of bounds
+        bool at(size_t index) const;
+
+        reference operator[](size_t index);
+        bool operator[](size_t index) const;
+
+        size_t size() const;
+
+        size_t capacity() const;
+
+        bool empty() const;
+
+        void clear();
+
+        void reserve(size_t newCapacity);
+
+        void set();                  // every flag to true
+        void reset();                // every flag to false
+        void flip();                 // bitwise not, in place
+
+        /* Word-at-a-time bulk operations; both operands must have the same size */
+        BitVectorLite& operator&=(const BitVectorLite& rhs);
+        BitVectorLite& operator|=(const BitVectorLite& rhs);
+        BitVectorLite& operator^=(const BitVectorLite& rhs);
+        BitVectorLite operator~() const;
+
+        size_t count() const;        // number of set flags
+        bool any() const;
+        bool none() const;
+        bool all() const;
+
+        size_t find_first() const;          // index of the first set flag, npos if none
+        size_t find_next(size_t pos) const; // first set flag after pos, npos if none
+
+        size_t word_count() const;
+        const uint64_t* words() const; // raw packed storage, word_count() long
+
+        bool operator==(const BitVectorLite& rhs) const;
+        bool operator!=(const BitVectorLite& rhs) const;
+
+        void print() const;
+
+        friend void swap(BitVectorLite& bv1, BitVectorLite& bv2) noexcept
+        {
+            bv1.swap(bv2);
+        }
+
+        class iterator {
+            private:
+                BitVectorLite* bv;
+                size_t idx;
+            public:
+                using value_type = bool;
+                using difference_type = std::ptrdiff_t;
+                using pointer = void;
+                using reference = BitVectorLite::reference;
+                using iterator_category = std::forward_iterator_tag;
+                iterator(BitVectorLite* b, size_t i) : bv(b), idx(i) {}
+
+                reference operator*() { return (*bv)[idx]; }
+
+                iterator& operator++() { idx++; return *this; }
+                iterator& operator--() { idx--; return *this; }
+                iterator operator++(int) { iterator old(bv, idx); idx++; return old; }
+                iterator operator--(int) { iterator old(bv, idx); idx--; return old; }
+
+                bool operator==(const iterator& other) const { return idx == other.idx; }
+                bool operator!=(const iterator& other) const { return idx != other.idx; }
+        };
+
+        class const_iterator {
+            private:
+                const BitVectorLite* bv;
+                size_t idx;
+            public:
+                using value_type = bool;
+                using difference_type = std::ptrdiff_t;
+                using pointer = void;
+                using reference = bool;
+                using iterator_category = std::forward_iterator_tag;
+                const_iterator(const BitVectorLite* b, size_t i) : bv(b), idx(i) {}
+
+                bool operator*() const { return (*bv)[idx]; }
+
+                const_iterator& operator++() { idx++; return *this; }
+                const_iterator& operator--() { idx--; return *this; }
+                const_iterator operator++(int) { const_iterator old(bv, idx); idx++; return old; }
+                const_iterator operator--(int) { const_iterator old(bv, idx); idx--; return old; }
+
+                bool operator==(const const_iterator& other) const { return idx == other.idx; }
+                bool operator!=(const const_iterator& other) const { return idx != other.idx; }
+        };
+
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+
+    private:
+
+        static constexpr size_t word_bits = 64;
+
+        VectorLite<uint64_t> bits; // bits.size() == words needed for nbits
+        size_t nbits;
+
+        static size_t words_for(size_t count) { return (count + word_bits - 1) / word_bits; }
+        static uint64_t bit_mask(size_t index) { return uint64_t{1} << (index % word_bits); }
+        uint64_t tail_mask() const;
+        void clear_unused_bits();
+        void require_same_size(const BitVectorLite& rhs) const;
+        void swap(BitVectorLite& other) noexcept;
+};
+
+BitVectorLite operator&(BitVectorLite lhs, const BitVectorLite& rhs);
+BitVectorLite operator|(BitVectorLite lhs, const BitVectorLite& rhs);
+BitVectorLite operator^(BitVectorLite lhs, const BitVectorLite& rhs);
+
+namespace bitvector_detail
+{
+    /* Four independent chains keep popcnt's pipeline full. Always inlined, so the
+       builtin becomes one popcnt instruction inside the popcnt-targeted callers. */
+    __attribute__((always_inline)) inline size_t popcount_chains(const uint64_t* w, size_t n)
+    {
+        size_t idx = 0;
+        size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+        for (; idx + 4 <= n; idx += 4)
+        {
+            c0 += static_cast<size_t>(__builtin_popcountll(w[idx]));
+            c1 += static_cast<size_t>(__builtin_popcountll(w[idx + 1]));
+            c2 += static_cast<size_t>(__builtin_popcountll(w[idx + 2]));
+            c3 += static_cast<size_t>(__builtin_popcountll(w[idx + 3]));
+        }
+        for (; idx < n; idx++)
+            c0 += static_cast<size_t>(__builtin_popcountll(w[idx]));
+        return c0 + c1 + c2 + c3;
+    }
+
+#if defined(VECTORLITE_TARGET_AVX2)
+    /* AVX2 nibble-lookup popcount (Mula et al.), four words per step */
+    VECTORLITE_TARGET_AVX2 inline size_t popcount_avx2(const uint64_t* w, size_t n)
+    {
+        const __m256i lookup = _mm256_setr_epi8(
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i lowNibble = _mm256_set1_epi8(0x0f);
+        __m256i acc = _mm256_setzero_si256();
+        size_t idx = 0;
+        for (; idx + 4 <= n; idx += 4)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + idx));
+            __m256i lo = _mm256_and_si256(v, lowNibble);
+            __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), lowNibble);
+            __m256i perByte = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+                                              _mm256_shuffle_epi8(lookup, hi));
+            acc = _mm256_add_epi64(acc, _mm256_sad_epu8(perByte, _mm256_setzero_si256()));
+        }
+        return static_cast<size_t>(_mm256_extract_epi64(acc, 0)) + static_cast<size_t>(_mm256_extract_epi64(acc, 1))
+             + static_cast<size_t>(_mm256_extract_epi64(acc, 2)) + static_cast<size_t>(_mm256_extract_epi64(acc, 3))
+             + popcount_chains(w + idx, n - idx);
+    }
+#endif
+
+#if defined(VECTORLITE_POPCOUNT_DISPATCH)
+    __attribute__((target("popcnt"))) inline size_t popcount_hw(const uint64_t* w, size_t n)
+    {
+        return popcount_chains(w, n);
+    }
+
+    enum class PopcountKernel { Avx2, Popcnt, Generic };
+
+    inline PopcountKernel detect_popcount_kernel()
+    {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+            return PopcountKernel::Avx2;
+        if (__builtin_cpu_supports("popcnt"))
+            return PopcountKernel::Popcnt;
+        return PopcountKernel::Generic;
+    }
+#endif
+
+    /* Population count of n words. AVX2 when compiled with -mavx2; otherwise, on
+       x86 with GCC/Clang, the best kernel the running CPU supports, chosen once. */
+    inline size_t popcount_words(const uint64_t* w, size_t n)
+    {
+#if defined(__AVX2__)
+        return popcount_avx2(w, n);
+#elif defined(VECTORLITE_POPCOUNT_DISPATCH)
+        static const PopcountKernel kernel = detect_popcount_kernel();
+        if (kernel == PopcountKernel::Avx2)
+            return popcount_avx2(w, n);
+        if (kernel == PopcountKernel::Popcnt)
+            return popcount_hw(w, n);
+        return popcount_chains(w, n);
+#else
+        return popcount_chains(w, n);
+#endif
+    }
+}
+
+// ============================== Definitions ==============================
+
+inline BitVectorLite::BitVectorLite():
+    bits {},
+    nbits { 0 }
+{ }
+
+inline BitVectorLite::BitVectorLite(size_t count, bool value):
+    bits ( words_for(count) ),
+    nbits { count }
+{
+    const uint64_t fill = value ? ~uint64_t{0} : uint64_t{0};
+    for (size_t idx = 0; idx < words_for(count); idx++)
+    {
+        bits.push_back(fill);
+    }
+    clear_unused_bits();
+}
+
+inline BitVectorLite::BitVectorLite(std::initializer_list<bool> initList):
+    bits ( words_for(initList.size()) ),
+    nbits { 0 }
+{
+    for (bool val : initList)
+    {
+        push_back(val);
+    }
+}
+
+inline BitVectorLite::BitVectorLite(BitVectorLite&& other) noexcept:
+    bits { std::move(other.bits) },
+    nbits { other.nbits }
+{
+    other.nbits = 0;
+}
+
+inline BitVectorLite& BitVectorLite::operator=(const BitVectorLite& rhs)
+{
+    BitVectorLite temp = rhs;
+    swap(temp);
+
+    return *this;
+}
+
+inline BitVectorLite& BitVectorLite::operator=(BitVectorLite&& toMove) noexcept
+{
+    swap(toMove);
+    return *this;
+}
+
+inline uint64_t BitVectorLite::tail_mask() const
+{
+    size_t used = nbits % word_bits;
+    return used == 0 ? ~uint64_t{0} : (uint64_t{1} << used) - 1;
+}
+
+inline void BitVectorLite::clear_unused_bits()
+{
+    if (!bits.empty())
+        bits[bits.size() - 1] &= tail_mask();
+}
+
+inline void BitVectorLite::require_same_size(const BitVectorLite& rhs) const
+{
+    if (nbits != rhs.nbits)
+        throw std::invalid_argument("BitVectorLite sizes differ");
+}
+
+inline void BitVectorLite::push_back(bool value)
+{
+    if (nbits % word_bits == 0)
+        bits.push_back(0);
+    if (value)
+        bits[nbits / word_bits] |= bit_mask(nbits);
+    nbits++;
+}
+
+inline void BitVectorLite::pop_back()
+{
+    nbits--;
+    bits[nbits / word_bits] &= ~bit_mask(nbits);
+    if (nbits % word_bits == 0)
+        bits.pop_back();
+}
+
+inline void BitVectorLite::pop()
+{
+    if (nbits == 0)
+        throw std::out_of_range("Attempt to pop an empty array");
+    pop_back();
+}
+
+inline BitVectorLite::reference BitVectorLite::at(size_t index)
+{
+    if (index >= nbits)
+        throw std::out_of_range("Index out of bounds");
+    return (*this)[index];
+}
+
+inline bool BitVectorLite::at(size_t index) const
+{
+    if (index >= nbits)
+        throw std::out_of_range("Index out of bounds");
+    return (*this)[index];
+}
+
+inline BitVectorLite::reference BitVectorLite::operator[](size_t index)
+{
+    return reference(&bits[index / word_bits], bit_mask(index));
+}
+
+inline bool BitVectorLite::operator[](size_t index) const
+{
+    return (bits[index / word_bits] & bit_mask(index)) != 0;
+}
+
+inline size_t BitVectorLite::size() const
+{
+    return nbits;
+}
+
+inline size_t BitVectorLite::capacity() const
+{
+    return bits.capacity() * word_bits;
+}
+
+inline bool BitVectorLite::empty() const
+{
+    return nbits == static_cast<size_t>(0);
+}
+
+inline void BitVectorLite::clear()
+{
+    bits.clear();
+    nbits = 0;
+}
+
+inline void BitVectorLite::reserve(size_t newCapacity)
+{
+    bits.reserve(words_for(newCapacity));
+}
+
+inline void BitVectorLite::set()
+{
+    for (size_t idx = 0; idx < bits.size(); idx++)
+        bits[idx] = ~uint64_t{0};
+    clear_unused_bits();
+}
+
+inline void BitVectorLite::reset()
+{
+    for (size_t idx = 0; idx < bits.size(); idx++)
+        bits[idx] = 0;
+}
+
+inline void BitVectorLite::flip()
+{
+    for (size_t idx = 0; idx < bits.size(); idx++)
+        bits[idx] = ~bits[idx];
+    clear_unused_bits();
+}
+
+inline BitVectorLite& BitVectorLite::operator&=(const BitVectorLite& rhs)
+{
+    require_same_size(rhs);
+    for (size_t idx = 0; idx < bits.size(); idx++)
+        bits[idx] &= rhs.bits[idx];
+    return *this;
+}
+
+inline BitVectorLite& BitVectorLite::operator|=(const BitVectorLite& rhs)
+{
+    require_same_size(rhs);
+    for (size_t idx = 0; idx < bits.size(); idx++)
+        bits[idx] |= rhs.bits[idx];
+    return *this;
+}
+
+inline BitVectorLite& BitVectorLite::operator^=(const BitVectorLite& rhs)
+{
+    require_same_size(rhs);
+    for (size_t idx = 0; idx < bits.size(); idx++)
+        bits[idx] ^= rhs.bits[idx];
+    return *this;
+}
+
+inline BitVectorLite BitVectorLite::operator~() const
+{
+    BitVectorLite result = *this;
+    result.flip();
+    return result;
+}
+
+inline BitVectorLite operator&(BitVectorLite lhs, const BitVectorLite& rhs)
+{
+    return lhs &= rhs;
+}
+
+inline BitVectorLite operator|(BitVectorLite lhs, const BitVectorLite& rhs)
+{
+    return lhs |= rhs;
+}
+
+inline BitVectorLite operator^(BitVectorLite lhs, const BitVectorLite& rhs)
+{
+    return lhs ^= rhs;
+}
+
+inline size_t BitVectorLite::count() const
+{
+    return bitvector_detail::popcount_words(words(), bits.size());
+}
+
+inline bool BitVectorLite::any() const
+{
+    for (uint64_t w : bits)
+    {
+        if (w != 0)
+            return true;
+    }
+    return false;
+}
+
+inline bool BitVectorLite::none() const
+{
+    return !any();
+}
+
+inline bool BitVectorLite::all() const
+{
+    return count() == nbits;
+}
+
+inline size_t BitVectorLite::find_first() const
+{
+    for (size_t idx = 0; idx < bits.size(); idx++)
+    {
+        if (bits[idx] != 0)
+            return idx * word_bits + static_cast<size_t>(__builtin_ctzll(bits[idx]));
+    }
+    return npos;
+}
+
+inline size_t BitVectorLite::find_next(size_t pos) const
+{
+    size_t next = pos + 1;
+    if (pos == npos || next >= nbits)
+        return npos;
+
+    size_t idx = next / word_bits;
+    uint64_t w = bits[idx] & (~uint64_t{0} << (next % word_bits));
+    while (w == 0)
+    {
+        if (++idx == bits.size())
+            return npos;
+        w = bits[idx];
+    }
+    return idx * word_bits + static_cast<size_t>(__builtin_ctzll(w));
+}
+
+inline size_t BitVectorLite::word_count() const
+{
+    return bits.size();
+}
+
+inline const uint64_t* BitVectorLite::words() const
+{
+    return bits.empty() ? nullptr : &bits[0];
+}
+
+inline bool BitVectorLite::operator==(const BitVectorLite& rhs) const
+{
+    return nbits == rhs.nbits && bits == rhs.bits;
+}
+
+inline bool BitVectorLite::operator!=(const BitVectorLite& rhs) const
+{
+    return !(*this == rhs);
+}
+
+inline void BitVectorLite::print() const
+{
+    std::cout << "[";
+    for (size_t idx = 0; idx < nbits; idx++)
+    {
+        std::cout << ((*this)[idx] ? 1 : 0);
+    }
+    std::cout << "]\n";
+}
+
+inline void BitVectorLite::swap(BitVectorLite& other) noexcept
+{
+    using std::swap;
+    swap(bits, other.bits);
+    swap(nbits, other.nbits);
+}
+
+inline BitVectorLite::iterator BitVectorLite::begin() { return iterator(this, 0); }
+
+inline BitVectorLite::iterator BitVectorLite::end() { return iterator(this, nbits); }
+
+inline BitVectorLite::const_iterator BitVectorLite::begin() const { return const_iterator(this, 0); }
+
+inline BitVectorLite::const_iterator BitVectorLite::end() const { return const_iterator(this, nbits); }
+
+inline BitVectorLite::const_iterator BitVectorLite::cbegin() const { return begin(); }
+
+inline BitVectorLite::const_iterator BitVectorLite::cend() const { return end(); }
@@ -0,0 +1,539 @@
+#pragma once
+
+#include "Vector.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*
+ * Append-only integer column stored as 128-value blocks.
+ * Each full block keeps its first value plus the deltas between neighbours,
+ * shifted by the block's smallest delta (frame of reference) and bit-packed
+ * at the narrowest width that fits. Sorted IDs and timestamps with small gaps
+ * pack to a few bits per value. Unsorted data still round-trips exactly
+ * because the deltas wrap modulo 2^bits.
+ *
+ * The last, partial block stays uncompressed until it fills up.
+ */
+template <typename Int>
+class CompressedVectorLite
+{
+    static_assert(std::is_integral<Int>::value, "CompressedVectorLite needs an integer type");
+
+    public:
+        static constexpr size_t block_size = 128;
+        static constexpr size_t checkpoint_stride = 32; // random access decodes at most this many - 1 deltas
+
+        CompressedVectorLite();
+        CompressedVectorLite(const VectorLite<Int>& values);
+        CompressedVectorLite(std::initializer_list<Int> list);
+
+        void push_back(Int value);
+
+        Int at(size_t index) const; // throws std::out_of_range if out of bounds
+        Int operator[](size_t index) const; // starts from the nearest checkpoint, at most 31 deltas
+
+        size_t size() const;
+
+        bool empty() const;
+
+        void clear();
+
+        size_t block_count() const; // full blocks plus the partial tail block, if any
+
+        /* Writes the values of block `block` to out, returns how many (block_size except for the tail) */
+        size_t decode_block(size_t block, Int* out) const;
+
+        VectorLite<Int> decompress() const;
+
+        size_t memory_bytes() const;     // bytes of compressed + tail storage in use
+        size_t raw_bytes() const;        // what the same data costs as a VectorLite<Int>
+
+        bool operator==(const CompressedVectorLite<Int>& rhs) const;
+        bool operator!=(const CompressedVectorLite<Int>& rhs) const;
+
+        /* Sequential decoder: unpacks one block into a local buffer at a time */
+        class const_iterator {
+            private:
+                const CompressedVectorLite<Int>* cv;
+                size_t idx;
+                size_t loadedBlock;
+                Int buffer[block_size];
+                void load()
+                {
+                    size_t block = idx / block_size;
+                    if (block != loadedBlock && idx < cv->total)
+                    {
+                        cv->decode_block(block, buffer);
+                        loadedBlock = block;
+                    }
+                }
+            public:
+                using value_type = Int;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const Int*;
+                using reference = const Int&;
+                using iterator_category = std::forward_iterator_tag;
+                const_iterator(const CompressedVectorLite<Int>* c, size_t i) :
+                    cv(c), idx(i), loadedBlock(static_cast<size_t>(-1)) { load(); }
+
+                const Int& operator*() const { return buffer[idx % block_size]; }
+
+                const_iterator& operator++() { idx++; if (idx % block_size == 0) load(); return *this; }
+                const_iterator operator++(int) { const_iterator old = *this; ++(*this); return old; }
+
+                bool operator==(const const_iterator& other) const { return idx == other.idx; }
+                bool operator!=(const const_iterator& other) const { return idx != other.idx; }
+        };
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+
+    private:
+
+        using U = typename std::make_unsigned<Int>::type;
+        using S = typename std::make_signed<Int>::type;
+        using Word = typename std::conditional<(sizeof(U) > 4), uint64_t, uint32_t>::type;
+
+        struct BlockHeader
+        {
+            size_t offset;   // first word of this block in `packed`
+            U first;         // the block's first value
+            U minDelta;      // frame of reference subtracted from every delta
+            uint8_t width;   // bits per packed delta; the block uses width * lanes words
+            U checkpoints[block_size / checkpoint_stride - 1]; // values at 32, 64 and 96
+        };
+
+        VectorLite<BlockHeader> headers;
+        VectorLite<Word> packed;
+        U tail[block_size];
+        size_t tailCount;
+        size_t total;
+
+        void flush_tail();
+};
+
+namespace compressed_detail
+{
+    template <typename U>
+    unsigned bit_width(U value)
+    {
+        unsigned width = 0;
+        while (value != 0)
+        {
+            width++;
+            value = static_cast<U>(value >> 1);
+        }
+        return width;
+    }
+
+    /*
+     * Lane-interleaved layout (as in SIMD-BP128): value i lives in lane i % L
+     * at slot i / L, where L = 128 / bits-per-word. Each lane packs its values
+     * back to back, and word k of every lane is stored next to word k of the
+     * other lanes. Unpacking one slot for all lanes then shifts L adjacent
+     * words by the same amount, which the compiler turns into one SIMD shift.
+     * A block of width W takes exactly W * L words.
+     */
+    template <typename Word>
+    struct Layout
+    {
+        static constexpr unsigned word_bits = std::numeric_limits<Word>::digits;
+        static constexpr size_t lanes = 128 / word_bits;
+        static constexpr size_t slots = 128 / lanes; // == word_bits
+    };
+
+    template <typename Word, typename U>
+    void pack_block(const U* in, unsigned width, VectorLite<Word>& out)
+    {
+        using L = Layout<Word>;
+        const size_t base = out.size();
+        for (size_t w = 0; w < width * L::lanes; w++)
+            out.push_back(0);
+        for (size_t slot = 0; slot < L::slots; slot++)
+        {
+            const size_t bit = slot * width;
+            const size_t row = bit / L::word_bits;
+            const unsigned shift = bit % L::word_bits;
+            for (size_t lane = 0; lane < L::lanes; lane++)
+            {
+                const Word v = static_cast<Word>(in[slot * L::lanes + lane]);
+                out[base + row * L::lanes + lane] |= static_cast<Word>(v << shift);
+                if (shift + width > L::word_bits)
+                    out[base + (row + 1) * L::lanes + lane] |= static_cast<Word>(v >> (L::word_bits - shift));
+            }
+        }
+    }
+
+    template <typename Word, typename U>
+    U unpack_one(const Word* in, unsigned width, size_t index)
+    {
+        using L = Layout<Word>;
+        const size_t lane = index % L::lanes;
+        const size_t bit = (index / L::lanes) * width;
+        const size_t row = bit / L::word_bits;
+        const unsigned shift = bit % L::word_bits;
+        const Word mask = width == L::word_bits ? static_cast<Word>(~Word{0}) : static_cast<Word>((Word{1} << width) - 1);
+        Word v = static_cast<Word>(in[row * L::lanes + lane] >> shift);
+        if (shift + width > L::word_bits)
+            v |= static_cast<Word>(in[(row + 1) * L::lanes + lane] << (L::word_bits - shift));
+        return static_cast<U>(v & mask);
+    }
+
+    /* One slot of every lane. Width and slot are template parameters, so the
+       shifts, masks and the straddle test are constants and the lane loop
+       compiles to a few SIMD shift/or/and instructions */
+    template <typename Word, typename U, unsigned W, size_t Slot>
+    inline void unpack_slot(const Word* in, U* out)
+    {
+        using L = Layout<Word>;
+        constexpr Word mask = W == L::word_bits ? static_cast<Word>(~Word{0}) : static_cast<Word>((Word{1} << (W % L::word_bits)) - 1);
+        constexpr size_t bit = Slot * W;
+        constexpr size_t row = bit / L::word_bits;
+        constexpr unsigned shift = bit % L::word_bits;
+        constexpr bool straddles = shift + W > L::word_bits;
+
+        // all loads before any store, so the lane loop vectorizes even though in and out may alias
+        Word lanes[L::lanes];
+        for (size_t lane = 0; lane < L::lanes; lane++)
+        {
+            Word v = static_cast<Word>(in[row * L::lanes + lane] >> shift);
+            if constexpr (straddles)
+                v |= static_cast<Word>(in[(row + 1) * L::lanes + lane] << ((L::word_bits - shift) % L::word_bits));
+            lanes[lane] = static_cast<Word>(v & mask);
+        }
+        for (size_t lane = 0; lane < L::lanes; lane++)
+            out[Slot * L::lanes + lane] = static_cast<U>(lanes[lane]);
+    }
+
+    template <typename Word, typename U, unsigned W, size_t... Slots>
+    void unpack_block(const Word* in, U* out, std::index_sequence<Slots...>)
+    {
+        if constexpr (W == 0)
+        {
+            for (size_t i = 0; i < 128; i++)
+                out[i] = 0;
+        }
+        else
+        {
+            (unpack_slot<Word, U, W, Slots>(in, out), ...);
+        }
+    }
+
+    template <typename Word, typename U, unsigned W>
+    void unpack_block(const Word* in, U* out)
+    {
+        unpack_block<Word, U, W>(in, out, std::make_index_sequence<Layout<Word>::slots>{});
+    }
+
+    /* out[i] = first + sum over j <= i of (frame + deltas[j]) */
+    template <typename U, typename Int>
+    void prefix_sum(const U* deltas, U first, U frame, Int* out)
+    {
+#if defined(__SSE2__)
+        if constexpr (sizeof(U) == 4)
+        {
+            // In-register scan of 4 lanes, then add the running total of all earlier lanes
+            const __m128i frameVec = _mm_set1_epi32(static_cast<int>(frame));
+            __m128i carry = _mm_set1_epi32(static_cast<int>(first));
+            for (size_t i = 0; i < 128; i += 4)
+            {
+                __m128i x = _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(deltas + i)), frameVec);
+                x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+                x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+                x = _mm_add_epi32(x, carry);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), x);
+                carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+            }
+            return;
+        }
+#endif
+        U running = first;
+        for (size_t i = 0; i < 128; i++)
+        {
+            running = static_cast<U>(running + static_cast<U>(frame + deltas[i]));
+            out[i] = static_cast<Int>(running);
+        }
+    }
+
+    /* Sum of `count` packed deltas starting at `index`, with the width a constant */
+    template <typename Word, typename U, unsigned W>
+    U sum_deltas_fixed(const Word* in, size_t index, size_t count)
+    {
+        using L = Layout<Word>;
+        constexpr Word mask = W == L::word_bits ? static_cast<Word>(~Word{0}) : static_cast<Word>((Word{1} << (W % L::word_bits)) - 1);
+        U sum = 0;
+        for (size_t i = index; i < index + count; i++)
+        {
+            const size_t lane = i % L::lanes;
+            const size_t bit = (i / L::lanes) * W;
+            const size_t row = bit / L::word_bits;
+            const unsigned shift = bit % L::word_bits;
+            Word v = static_cast<Word>(in[row * L::lanes + lane] >> shift);
+            if (shift + W > L::word_bits)
+                v |= static_cast<Word>(in[(row + 1) * L::lanes + lane] << ((L::word_bits - shift) % L::word_bits));
+            sum = static_cast<U>(sum + static_cast<U>(v & mask));
+        }
+        return sum;
+    }
+
+    template <typename Word, typename U>
+    using SumFn = U (*)(const Word*, size_t, size_t);
+
+    template <typename Word, typename U, size_t... Widths>
+    const SumFn<Word, U>* sum_table(std::index_sequence<Widths...>)
+    {
+        static const SumFn<Word, U> table[] = { &sum_deltas_fixed<Word, U, static_cast<unsigned>(Widths)>... };
+        return table;
+    }
+
+    template <typename Word, typename U>
+    U sum_deltas(const Word* in, unsigned width, size_t index, size_t count)
+    {
+        static const SumFn<Word, U>* table =
+            sum_table<Word, U>(std::make_index_sequence<std::numeric_limits<U>::digits + 1>{});
+        return table[width](in, index, count);
+    }
+
+    template <typename Word, typename U>
+    using UnpackFn = void (*)(const Word*, U*);
+
+    template <typename Word, typename U, size_t... Widths>
+    const UnpackFn<Word, U>* unpack_table(std::index_sequence<Widths...>)
+    {
+        static const UnpackFn<Word, U> table[] = { &unpack_block<Word, U, static_cast<unsigned>(Widths)>... };
+        return table;
+    }
+
+    template <typename Word, typename U>
+    void unpack(const Word* in, unsigned width, U* out)
+    {
+        static const UnpackFn<Word, U>* table =
+            unpack_table<Word, U>(std::make_index_sequence<std::numeric_limits<U>::digits + 1>{});
+        table[width](in, out);
+    }
+}
+
+// ============================== Definitions ==============================
+
+template <typename Int>
+CompressedVectorLite<Int>::CompressedVectorLite():
+    headers {},
+    packed {},
+    tailCount { 0 },
+    total { 0 }
+{ }
+
+template <typename Int>
+CompressedVectorLite<Int>::CompressedVectorLite(const VectorLite<Int>& values):
+    headers ( values.size() / block_size + 1 ),
+    packed {},
+    tailCount { 0 },
+    total { 0 }
+{
+    for (const Int& val : values)
+    {
+        push_back(val);
+    }
+}
+
+template <typename Int>
+CompressedVectorLite<Int>::CompressedVectorLite(std::initializer_list<Int> initList):
+    CompressedVectorLite()
+{
+    for (const Int& val : initList)
+    {
+        push_back(val);
+    }
+}
+
+template <typename Int>
+void CompressedVectorLite<Int>::push_back(Int value)
+{
+    tail[tailCount++] = static_cast<U>(value);
+    total++;
+    if (tailCount == block_size)
+        flush_tail();
+}
+
+template <typename Int>
+void CompressedVectorLite<Int>::flush_tail()
+{
+    U deltas[block_size];
+    deltas[0] = 0;
+    U minDelta = static_cast<U>(tail[1] - tail[0]);
+    for (size_t i = 1; i < block_size; i++)
+    {
+        deltas[i] = static_cast<U>(tail[i] - tail[i - 1]);
+        if (static_cast<S>(deltas[i]) < static_cast<S>(minDelta))
+            minDelta = deltas[i];
+    }
+
+    U widest = 0;
+    for (size_t i = 1; i < block_size; i++)
+    {
+        deltas[i] = static_cast<U>(deltas[i] - minDelta);
+        widest |= deltas[i];
+    }
+    const unsigned width = compressed_detail::bit_width(widest);
+
+    BlockHeader header { packed.size(), tail[0], minDelta, static_cast<uint8_t>(width), {} };
+    for (size_t mark = 1; mark < block_size / checkpoint_stride; mark++)
+    {
+        header.checkpoints[mark - 1] = tail[mark * checkpoint_stride];
+    }
+    headers.push_back(header);
+    compressed_detail::pack_block(deltas, width, packed);
+    tailCount = 0;
+}
+
+template <typename Int>
+size_t CompressedVectorLite<Int>::decode_block(size_t block, Int* out) const
+{
+    if (block == headers.size())
+    {
+        for (size_t i = 0; i < tailCount; i++)
+            out[i] = static_cast<Int>(tail[i]);
+        return tailCount;
+    }
+
+    const BlockHeader& header = headers[block];
+    U deltas[block_size];
+    compressed_detail::unpack(header.width ? &packed[header.offset] : nullptr, header.width, deltas);
+
+    deltas[0] = static_cast<U>(0 - header.minDelta); // so slot 0 decodes to `first` below
+    compressed_detail::prefix_sum(deltas, header.first, header.minDelta, out);
+    return block_size;
+}
+
+template <typename Int>
+Int CompressedVectorLite<Int>::at(size_t index) const
+{
+    if (index >= total)
+        throw std::out_of_range("Index out of bounds");
+    return (*this)[index];
+}
+
+template <typename Int>
+Int CompressedVectorLite<Int>::operator[](size_t index) const
+{
+    const size_t block = index / block_size;
+    const size_t pos = index % block_size;
+    if (block == headers.size())
+        return static_cast<Int>(tail[pos]);
+
+    const BlockHeader& header = headers[block];
+    const size_t mark = pos / checkpoint_stride;
+    const size_t from = mark * checkpoint_stride;
+    U running = mark ? header.checkpoints[mark - 1] : header.first;
+    running = static_cast<U>(running + header.minDelta * static_cast<U>(pos - from));
+    if (header.width == 0)
+        return static_cast<Int>(running);
+
+    const Word* words = &packed[header.offset];
+    running = static_cast<U>(running + compressed_detail::sum_deltas<Word, U>(words, header.width, from + 1, pos - from));
+    return static_cast<Int>(running);
+}
+
+template <typename Int>
+size_t CompressedVectorLite<Int>::size() const
+{
+    return total;
+}
+
+template <typename Int>
+bool CompressedVectorLite<Int>::empty() const
+{
+    return total == static_cast<size_t>(0);
+}
+
+template <typename Int>
+void CompressedVectorLite<Int>::clear()
+{
+    headers.clear();
+    packed.clear();
+    tailCount = 0;
+    total = 0;
+}
+
+template <typename Int>
+size_t CompressedVectorLite<Int>::block_count() const
+{
+    return headers.size() + (tailCount ? 1 : 0);
+}
+
+template <typename Int>
+VectorLite<Int> CompressedVectorLite<Int>::decompress() const
+{
+    VectorLite<Int> result(total);
+    Int buffer[block_size];
+    for (size_t block = 0; block < block_count(); block++)
+    {
+        size_t n = decode_block(block, buffer);
+        for (size_t i = 0; i < n; i++)
+        {
+            result.push_back(buffer[i]);
+        }
+    }
+    return result;
+}
+
+template <typename Int>
+size_t CompressedVectorLite<Int>::memory_bytes() const
+{
+    return headers.size() * sizeof(BlockHeader) + packed.size() * sizeof(Word) + sizeof(tail);
+}
+
+template <typename Int>
+size_t CompressedVectorLite<Int>::raw_bytes() const
+{
+    return total * sizeof(Int);
+}
+
+template <typename Int>
+bool CompressedVectorLite<Int>::operator==(const CompressedVectorLite<Int>& rhs) const
+{
+    if (total != rhs.total)
+        return false;
+
+    Int lhsBuf[block_size];
+    Int rhsBuf[block_size];
+    for (size_t block = 0; block < block_count(); block++)
+    {
+        size_t n = decode_block(block, lhsBuf);
+        rhs.decode_block(block, rhsBuf);
+        for (size_t i = 0; i < n; i++)
+        {
+            if (lhsBuf[i] != rhsBuf[i])
+                return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename Int>
+bool CompressedVectorLite<Int>::operator!=(const CompressedVectorLite<Int>& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename Int>
+typename CompressedVectorLite<Int>::const_iterator CompressedVectorLite<Int>::begin() const { return const_iterator(this, 0); }
+
+template <typename Int>
+typename CompressedVectorLite<Int>::const_iterator CompressedVectorLite<Int>::end() const { return const_iterator(this, total); }
+
+template <typename Int>
+typename CompressedVectorLite<Int>::const_iterator CompressedVectorLite<Int>::cbegin() const { return begin(); }
+
+template <typename Int>
+typename CompressedVectorLite<Int>::const_iterator CompressedVectorLite<Int>::cend() const { return end(); }
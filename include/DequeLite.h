@@ -0,0 +1,515 @@
+#pragma once
+
+#include "Vector.h"
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+/* What happens when a push finds the ring full */
+enum class DequeOverflow
+{
+    Grow,           // double the storage, like VectorLite::push_back
+    OverwriteOldest // bounded mode: evict the element at the opposite end
+};
+
+/*
+ * Contiguous circular buffer on top of VectorLite storage.
+ * Elements live in ring.data()[head .. head + count) modulo the capacity, so
+ * push/pop at either end is O(1) and indexing is a single add + compare.
+ */
+template <typename T>
+class DequeLite
+{
+    public:
+        DequeLite();
+        DequeLite(size_t initialCapacity);
+        DequeLite(size_t initialCapacity, DequeOverflow policy);
+        DequeLite(std::initializer_list<T> list);
+
+        /* RULE OF FIVE */
+        ~DequeLite() = default;
+
+        DequeLite(const DequeLite<T>& other); //Copy Constructor
+        DequeLite(DequeLite<T>&& other) noexcept; //Move constructor
+
+        DequeLite<T>& operator=(const DequeLite<T>& rhs); //Copy assign
+        DequeLite<T>& operator=(DequeLite<T>&& rhs) noexcept; //Move assign
+
+        void push_back(const T& lvalue);
+        void push_back(T&& rvalue);
+        void push_front(const T& lvalue);
+        void push_front(T&& rvalue);
+
+        void pop_back();
+        void pop_front();
+
+        void pop(); // Exception Defined version of pop_front
+
+        T& front();
+        const T& front() const;
+        T& back();
+        const T& back() const;
+
+        T& at(size_t index); // throws std::out_of_range if out of bounds
+        const T& at(size_t index) const;
+
+        T& operator[](size_t index);
+        const T& operator[](size_t index) const;
+
+        size_t size() const;
+
+        size_t capacity() const;
+
+        bool empty() const;
+
+        bool full() const;
+
+        void clear();
+
+        void reserve(size_t newCapacity);
+
+        DequeOverflow overflow_policy() const;
+
+        /* Rotates the ring in place so that the elements are contiguous and
+           returns a pointer to the first one. No copy is made when the live
+           range does not wrap. The pointer is valid until the next push. */
+        T* linearize();
+
+        bool operator==(const DequeLite<T>& rhs) const;
+        bool operator!=(const DequeLite<T>& rhs) const;
+
+        friend void swap(DequeLite<T>& dq1, DequeLite<T>& dq2) noexcept
+        {
+            dq1.swap(dq2);
+        }
+
+        class iterator {
+            private:
+                DequeLite<T>* dq;
+                size_t idx;
+            public:
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = T*;
+                using reference = T&;
+                using iterator_category = std::forward_iterator_tag;
+                iterator(DequeLite<T>* d, size_t i) : dq(d), idx(i) {}
+
+                T& operator*() { return (*dq)[idx]; }
+
+                iterator& operator++() { idx++; return *this; }
+                iterator& operator--() { idx--; return *this; }
+                iterator operator++(int) { iterator old(dq, idx); idx++; return old; }
+                iterator operator--(int) { iterator old(dq, idx); idx--; return old; }
+
+                bool operator==(const iterator& other) const { return idx == other.idx; }
+                bool operator!=(const iterator& other) const { return idx != other.idx; }
+        };
+
+        class const_iterator {
+            private:
+                const DequeLite<T>* dq;
+                size_t idx;
+            public:
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+                using iterator_category = std::forward_iterator_tag;
+                const_iterator(const DequeLite<T>* d, size_t i) : dq(d), idx(i) {}
+
+                const T& operator*() const { return (*dq)[idx]; }
+
+                const_iterator& operator++() { idx++; return *this; }
+                const_iterator& operator--() { idx--; return *this; }
+                const_iterator operator++(int) { const_iterator old(dq, idx); idx++; return old; }
+                const_iterator operator--(int) { const_iterator old(dq, idx); idx--; return old; }
+
+                bool operator==(const const_iterator& other) const { return idx == other.idx; }
+                bool operator!=(const const_iterator& other) const { return idx != other.idx; }
+        };
+
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+
+    private:
+
+        static constexpr size_t default_capacity = 4; // VectorLite's first allocation, for regrowing a moved-from ring
+
+        VectorLite<T> ring; // ring.size() is unused, every slot below ring.capacity()acity() is live storage
+        size_t head;
+        size_t count;
+        DequeOverflow overflow;
+
+        size_t physical(size_t index) const;
+        size_t prev_slot(size_t slot) const;
+        size_t next_slot(size_t slot) const;
+        bool make_room();
+        void grow_to(size_t newCapacity);
+        void swap(DequeLite<T>& other) noexcept;
+};
+
+// ============================== Definitions ==============================
+
+template <typename T>
+DequeLite<T>::DequeLite():
+    ring {},
+    head { 0 },
+    count { 0 },
+    overflow { DequeOverflow::Grow }
+{ }
+
+template <typename T>
+DequeLite<T>::DequeLite(size_t initialCapacity):
+    ring ( initialCapacity ),
+    head { 0 },
+    count { 0 },
+    overflow { DequeOverflow::Grow }
+{ }
+
+template <typename T>
+DequeLite<T>::DequeLite(size_t initialCapacity, DequeOverflow policy):
+    ring ( initialCapacity ),
+    head { 0 },
+    count { 0 },
+    overflow { policy }
+{ }
+
+template <typename T>
+DequeLite<T>::DequeLite(std::initializer_list<T> initList):
+    ring ( initList.size() ),
+    head { 0 },
+    count { 0 },
+    overflow { DequeOverflow::Grow }
+{
+    for (const T& val : initList)
+    {
+        push_back(val);
+    }
+}
+
+template <typename T>
+DequeLite<T>::DequeLite(const DequeLite<T>& other):
+    ring ( other.capacity() ),
+    head { 0 },
+    count { 0 },
+    overflow { other.overflow }
+{
+    for (size_t idx = 0; idx < other.count; idx++)
+    {
+        ring.data()[idx] = other[idx];
+    }
+    count = other.count;
+}
+
+template <typename T>
+DequeLite<T>::DequeLite(DequeLite<T>&& other) noexcept:
+    ring { std::move(other.ring) },
+    head { other.head },
+    count { other.count },
+    overflow { other.overflow }
+{
+    other.head = 0;
+    other.count = 0;
+}
+
+template <typename T>
+DequeLite<T>& DequeLite<T>::operator=(const DequeLite<T>& rhs)
+{
+    DequeLite<T> temp = rhs;
+    swap(temp);
+
+    return *this;
+}
+
+template <typename T>
+DequeLite<T>& DequeLite<T>::operator=(DequeLite<T>&& toMove) noexcept
+{
+    swap(toMove);
+    return *this;
+}
+
+template <typename T>
+size_t DequeLite<T>::physical(size_t index) const
+{
+    size_t slot = head + index;
+    return slot >= ring.capacity() ? slot - ring.capacity() : slot;
+}
+
+template <typename T>
+size_t DequeLite<T>::prev_slot(size_t slot) const
+{
+    return slot == 0 ? ring.capacity() - 1 : slot - 1;
+}
+
+template <typename T>
+size_t DequeLite<T>::next_slot(size_t slot) const
+{
+    return slot + 1 == ring.capacity() ? 0 : slot + 1;
+}
+
+/* Called on a full ring. Returns false when the caller must overwrite instead of append */
+template <typename T>
+bool DequeLite<T>::make_room()
+{
+    if (ring.capacity() == 0) // moved-from: no storage to overwrite or double
+    {
+        grow_to(default_capacity);
+        return true;
+    }
+    if (overflow == DequeOverflow::OverwriteOldest)
+        return false;
+    grow_to(ring.capacity() * 2);
+    return true;
+}
+
+template <typename T>
+void DequeLite<T>::grow_to(size_t newCapacity)
+{
+    using std::swap;
+    VectorLite<T> newRing(newCapacity, ring.alloc_options());
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        newRing.data()[idx] = std::move_if_noexcept(ring.data()[physical(idx)]);
+    }
+    swap(ring, newRing);
+    head = 0;
+}
+
+template <typename T>
+void DequeLite<T>::push_back(const T& lvalue)
+{
+    if (count == ring.capacity() && !make_room())
+    {
+        ring.data()[head] = lvalue;
+        head = next_slot(head);
+        return;
+    }
+    ring.data()[physical(count)] = lvalue;
+    count++;
+}
+
+template <typename T>
+void DequeLite<T>::push_back(T&& rvalue)
+{
+    if (count == ring.capacity() && !make_room())
+    {
+        ring.data()[head] = std::move(rvalue);
+        head = next_slot(head);
+        return;
+    }
+    ring.data()[physical(count)] = std::move(rvalue);
+    count++;
+}
+
+template <typename T>
+void DequeLite<T>::push_front(const T& lvalue)
+{
+    if (count == ring.capacity() && !make_room())
+    {
+        head = prev_slot(head);
+        ring.data()[head] = lvalue;
+        return;
+    }
+    head = prev_slot(head);
+    ring.data()[head] = lvalue;
+    count++;
+}
+
+template <typename T>
+void DequeLite<T>::push_front(T&& rvalue)
+{
+    if (count == ring.capacity() && !make_room())
+    {
+        head = prev_slot(head);
+        ring.data()[head] = std::move(rvalue);
+        return;
+    }
+    head = prev_slot(head);
+    ring.data()[head] = std::move(rvalue);
+    count++;
+}
+
+template <typename T>
+void DequeLite<T>::pop_back()
+{
+    count--;
+}
+
+template <typename T>
+void DequeLite<T>::pop_front()
+{
+    head = next_slot(head);
+    count--;
+}
+
+template <typename T>
+void DequeLite<T>::pop()
+{
+    if (count == 0)
+        throw std::out_of_range("Attempt to pop an empty deque");
+    pop_front();
+}
+
+template <typename T>
+T& DequeLite<T>::front()
+{
+    return ring.data()[head];
+}
+
+template <typename T>
+const T& DequeLite<T>::front() const
+{
+    return ring.data()[head];
+}
+
+template <typename T>
+T& DequeLite<T>::back()
+{
+    return ring.data()[physical(count - 1)];
+}
+
+template <typename T>
+const T& DequeLite<T>::back() const
+{
+    return ring.data()[physical(count - 1)];
+}
+
+template <typename T>
+T& DequeLite<T>::at(size_t index)
+{
+    if (index >= count)
+        throw std::out_of_range("Index out of bounds");
+    return ring.data()[physical(index)];
+}
+
+template <typename T>
+const T& DequeLite<T>::at(size_t index) const
+{
+    if (index >= count)
+        throw std::out_of_range("Index out of bounds");
+    return ring.data()[physical(index)];
+}
+
+template <typename T>
+T& DequeLite<T>::operator[](size_t index)
+{
+    return ring.data()[physical(index)];
+}
+
+template <typename T>
+const T& DequeLite<T>::operator[](size_t index) const
+{
+    return ring.data()[physical(index)];
+}
+
+template <typename T>
+size_t DequeLite<T>::size() const
+{
+    return count;
+}
+
+template <typename T>
+size_t DequeLite<T>::capacity() const
+{
+    return ring.capacity();
+}
+
+template <typename T>
+bool DequeLite<T>::empty() const
+{
+    return count == static_cast<size_t>(0);
+}
+
+template <typename T>
+bool DequeLite<T>::full() const
+{
+    return count == ring.capacity();
+}
+
+/* Keeps the storage so a drained queue can be refilled without reallocating */
+template <typename T>
+void DequeLite<T>::clear()
+{
+    head = 0;
+    count = 0;
+}
+
+template <typename T>
+void DequeLite<T>::reserve(size_t newCapacity)
+{
+    if (ring.capacity() >= newCapacity)
+        return;
+    grow_to(newCapacity);
+}
+
+template <typename T>
+DequeOverflow DequeLite<T>::overflow_policy() const
+{
+    return overflow;
+}
+
+template <typename T>
+T* DequeLite<T>::linearize()
+{
+    if (head + count > ring.capacity())
+    {
+        std::rotate(ring.data(), ring.data() + head, ring.data() + ring.capacity());
+        head = 0;
+    }
+    return ring.data() + head;
+}
+
+template <typename T>
+bool DequeLite<T>::operator==(const DequeLite<T>& rhs) const
+{
+    if (count != rhs.count)
+        return false;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if ((*this)[i] != rhs[i])
+            return false;
+    }
+
+    return true;
+}
+
+template <typename T>
+bool DequeLite<T>::operator!=(const DequeLite<T>& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename T>
+void DequeLite<T>::swap(DequeLite<T>& other) noexcept
+{
+    using std::swap;
+    swap(ring, other.ring);
+    swap(head, other.head);
+    swap(count, other.count);
+    swap(overflow, other.overflow);
+}
+
+template <typename T>
+typename DequeLite<T>::iterator DequeLite<T>::begin() { return iterator(this, 0); }
+
+template <typename T>
+typename DequeLite<T>::iterator DequeLite<T>::end() { return iterator(this, count); }
+
+template <typename T>
+typename DequeLite<T>::const_iterator DequeLite<T>::begin() const { return const_iterator(this, 0); }
+
+template <typename T>
+typename DequeLite<T>::const_iterator DequeLite<T>::end() const { return const_iterator(this, count); }
+
+template <typename T>
+typename DequeLite<T>::const_iterator DequeLite<T>::cbegin() const { return begin(); }
+
+template <typename T>
+typename DequeLite<T>::const_iterator DequeLite<T>::cend() const { return end(); }
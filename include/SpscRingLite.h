@@ -0,0 +1,365 @@
+#pragma once
+
+#include "Vector.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+/* How the blocking push/pop calls wait for room or data */
+enum class SpscWaitMode
+{
+    NonBlocking,  // never sleeps: waiters spin and yield, and the fast path skips the wake-up check
+    SpinThenPark  // spin briefly, then sleep on a condition variable until the other side signals
+};
+
+namespace spsc_detail
+{
+    constexpr size_t cache_line = 64;
+    constexpr int spin_iterations = 128;
+    constexpr int yield_iterations = 16;
+
+    inline void cpu_relax()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    inline size_t round_up_pow2(size_t n)
+    {
+        constexpr size_t largest = (std::numeric_limits<size_t>::max() >> 1) + 1;
+        if (n > largest) // doubling past the top bit would wrap to 0 and never stop
+            throw std::length_error("SpscRingLite capacity too large");
+        size_t pow2 = 2;
+        while (pow2 < n)
+            pow2 <<= 1;
+        return pow2;
+    }
+}
+
+/*
+ * Lock-free single-producer/single-consumer queue on VectorLite storage.
+ * head and tail are free-running counters masked into a power-of-two ring.
+ * Each side keeps a cached copy of the other side's index on its own cache
+ * line, so the shared line is only re-read when the cached view runs short.
+ *
+ * Exactly one thread may call the push family and exactly one thread the
+ * pop family.
+ */
+template <typename T>
+class SpscRingLite
+{
+    public:
+        SpscRingLite(size_t minCapacity, SpscWaitMode mode = SpscWaitMode::SpinThenPark);
+
+        SpscRingLite(const SpscRingLite<T>& other) = delete;
+        SpscRingLite<T>& operator=(const SpscRingLite<T>& rhs) = delete;
+
+        /* Non-blocking: return false / a short count instead of waiting */
+        bool try_push(const T& lvalue);
+        bool try_push(T&& rvalue);
+        bool try_pop(T& out);
+        size_t try_push_n(const T* src, size_t n); // copies up to n elements, returns how many
+        size_t try_pop_n(T* dst, size_t n);        // moves up to n elements out, returns how many
+
+        /* Blocking: wait according to the ring's SpscWaitMode */
+        void push(const T& lvalue);
+        void push(T&& rvalue);
+        T pop();
+        void push_n(const T* src, size_t n);  // returns once all n elements are queued
+        size_t pop_n(T* dst, size_t n);       // waits for at least one element, returns how many
+
+        size_t capacity() const;
+
+        size_t size() const; // approximate when called concurrently
+
+        bool empty() const;
+
+        SpscWaitMode wait_mode() const;
+
+    private:
+
+        /* Producer-owned line */
+        alignas(spsc_detail::cache_line) std::atomic<size_t> tail;
+        size_t cachedHead;
+
+        /* Consumer-owned line */
+        alignas(spsc_detail::cache_line) std::atomic<size_t> head;
+        size_t cachedTail;
+
+        /* Read-only after construction */
+        alignas(spsc_detail::cache_line) VectorLite<T> slots;
+        size_t mask;
+        SpscWaitMode mode;
+
+        /* Parking state, only touched once a side gives up spinning */
+        alignas(spsc_detail::cache_line) std::atomic<bool> consumerParked;
+        std::atomic<bool> producerParked;
+        std::mutex parkMutex;
+        std::condition_variable parkCv;
+
+        size_t free_slots(size_t wanted);
+        size_t ready_slots(size_t wanted);
+        void publish_tail(size_t newTail);
+        void publish_head(size_t newHead);
+        void wake_if_parked(std::atomic<bool>& parked);
+        template <typename Ready>
+        void wait_until(std::atomic<bool>& parked, Ready ready);
+};
+
+// ============================== Definitions ==============================
+
+template <typename T>
+SpscRingLite<T>::SpscRingLite(size_t minCapacity, SpscWaitMode waitMode):
+    tail { 0 },
+    cachedHead { 0 },
+    head { 0 },
+    cachedTail { 0 },
+    slots ( spsc_detail::round_up_pow2(minCapacity) ),
+    mask { slots.capacity() - 1 },
+    mode { waitMode },
+    consumerParked { false },
+    producerParked { false }
+{ }
+
+/* Producer side: refresh the cached head only when it shows less room than wanted */
+template <typename T>
+size_t SpscRingLite<T>::free_slots(size_t wanted)
+{
+    size_t t = tail.load(std::memory_order_relaxed);
+    size_t room = slots.capacity() - (t - cachedHead);
+    if (room < wanted)
+    {
+        cachedHead = head.load(std::memory_order_acquire);
+        room = slots.capacity() - (t - cachedHead);
+    }
+    return room;
+}
+
+/* Consumer side: refresh the cached tail only when it shows fewer elements than wanted */
+template <typename T>
+size_t SpscRingLite<T>::ready_slots(size_t wanted)
+{
+    size_t h = head.load(std::memory_order_relaxed);
+    size_t avail = cachedTail - h;
+    if (avail < wanted)
+    {
+        cachedTail = tail.load(std::memory_order_acquire);
+        avail = cachedTail - h;
+    }
+    return avail;
+}
+
+template <typename T>
+void SpscRingLite<T>::publish_tail(size_t newTail)
+{
+    tail.store(newTail, std::memory_order_release);
+    if (mode == SpscWaitMode::SpinThenPark)
+        wake_if_parked(consumerParked);
+}
+
+template <typename T>
+void SpscRingLite<T>::publish_head(size_t newHead)
+{
+    head.store(newHead, std::memory_order_release);
+    if (mode == SpscWaitMode::SpinThenPark)
+        wake_if_parked(producerParked);
+}
+
+/* Pairs with the fence in wait_until: either the waiter sees our index
+   store, or we see its parked flag and notify under the mutex. */
+template <typename T>
+void SpscRingLite<T>::wake_if_parked(std::atomic<bool>& parked)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parked.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> lock(parkMutex);
+        parkCv.notify_all();
+    }
+}
+
+template <typename T>
+template <typename Ready>
+void SpscRingLite<T>::wait_until(std::atomic<bool>& parked, Ready ready)
+{
+    for (int spin = 0; spin < spsc_detail::spin_iterations; spin++)
+    {
+        if (ready())
+            return;
+        spsc_detail::cpu_relax();
+    }
+    for (int spin = 0; spin < spsc_detail::yield_iterations; spin++)
+    {
+        if (ready())
+            return;
+        std::this_thread::yield();
+    }
+
+    if (mode == SpscWaitMode::NonBlocking)
+    {
+        while (!ready())
+            std::this_thread::yield();
+        return;
+    }
+
+    while (!ready())
+    {
+        parked.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(parkMutex);
+            parkCv.wait(lock, ready);
+        }
+        parked.store(false, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool SpscRingLite<T>::try_push(const T& lvalue)
+{
+    if (free_slots(1) == 0)
+        return false;
+    size_t t = tail.load(std::memory_order_relaxed);
+    slots.data()[t & mask] = lvalue;
+    publish_tail(t + 1);
+    return true;
+}
+
+template <typename T>
+bool SpscRingLite<T>::try_push(T&& rvalue)
+{
+    if (free_slots(1) == 0)
+        return false;
+    size_t t = tail.load(std::memory_order_relaxed);
+    slots.data()[t & mask] = std::move(rvalue);
+    publish_tail(t + 1);
+    return true;
+}
+
+template <typename T>
+bool SpscRingLite<T>::try_pop(T& out)
+{
+    if (ready_slots(1) == 0)
+        return false;
+    size_t h = head.load(std::memory_order_relaxed);
+    out = std::move(slots.data()[h & mask]);
+    publish_head(h + 1);
+    return true;
+}
+
+/* Copies in at most two runs: up to the end of the storage, then from the start */
+template <typename T>
+size_t SpscRingLite<T>::try_push_n(const T* src, size_t n)
+{
+    size_t count = std::min(n, free_slots(n));
+    if (count == 0)
+        return 0;
+    size_t t = tail.load(std::memory_order_relaxed);
+    size_t first = t & mask;
+    size_t firstRun = std::min(count, slots.capacity() - first);
+    std::copy(src, src + firstRun, slots.data() + first);
+    std::copy(src + firstRun, src + count, slots.data());
+    publish_tail(t + count);
+    return count;
+}
+
+template <typename T>
+size_t SpscRingLite<T>::try_pop_n(T* dst, size_t n)
+{
+    size_t count = std::min(n, ready_slots(n));
+    if (count == 0)
+        return 0;
+    size_t h = head.load(std::memory_order_relaxed);
+    size_t first = h & mask;
+    size_t firstRun = std::min(count, slots.capacity() - first);
+    std::move(slots.data() + first, slots.data() + first + firstRun, dst);
+    std::move(slots.data(), slots.data() + (count - firstRun), dst + firstRun);
+    publish_head(h + count);
+    return count;
+}
+
+template <typename T>
+void SpscRingLite<T>::push(const T& lvalue)
+{
+    while (!try_push(lvalue))
+        wait_until(producerParked, [this] { return free_slots(1) != 0; });
+}
+
+template <typename T>
+void SpscRingLite<T>::push(T&& rvalue)
+{
+    while (free_slots(1) == 0)
+        wait_until(producerParked, [this] { return free_slots(1) != 0; });
+    try_push(std::move(rvalue));
+}
+
+template <typename T>
+T SpscRingLite<T>::pop()
+{
+    T out;
+    while (!try_pop(out))
+        wait_until(consumerParked, [this] { return ready_slots(1) != 0; });
+    return out;
+}
+
+template <typename T>
+void SpscRingLite<T>::push_n(const T* src, size_t n)
+{
+    size_t done = try_push_n(src, n);
+    while (done < n)
+    {
+        wait_until(producerParked, [this] { return free_slots(1) != 0; });
+        done += try_push_n(src + done, n - done);
+    }
+}
+
+template <typename T>
+size_t SpscRingLite<T>::pop_n(T* dst, size_t n)
+{
+    if (n == 0)
+        return 0;
+    size_t done = try_pop_n(dst, n);
+    while (done == 0)
+    {
+        wait_until(consumerParked, [this] { return ready_slots(1) != 0; });
+        done = try_pop_n(dst, n);
+    }
+    return done;
+}
+
+template <typename T>
+size_t SpscRingLite<T>::capacity() const
+{
+    return slots.capacity();
+}
+
+template <typename T>
+size_t SpscRingLite<T>::size() const
+{
+    size_t h = head.load(std::memory_order_acquire);
+    size_t t = tail.load(std::memory_order_acquire);
+    return t - h;
+}
+
+template <typename T>
+bool SpscRingLite<T>::empty() const
+{
+    return size() == static_cast<size_t>(0);
+}
+
+template <typename T>
+SpscWaitMode SpscRingLite<T>::wait_mode() const
+{
+    return mode;
+}
@@ -1,7 +1,43 @@
+#pragma once
+
+#include <atomic>
 #include <cstddef>
 #include <iostream>
+#include <stdexcept>
 #include <utility>
 #include <initializer_list>
+#include <new>
+#include <string>
+#include <type_traits>
+#include "VectorLiteAlloc.h"
+
+template <typename E>
+class VectorLiteExpr;
+
+template <typename T>
+class VectorLite;
+
+namespace vector_detail
+{
+    /* For code that fills spare capacity in place (the loader reads and parses straight into it):
+       sets size() without touching any slot. Every slot below capacity() already holds a live
+       object, so the only precondition is size <= capacity(). */
+    template <typename T>
+    void set_size_unchecked(VectorLite<T>& vec, size_t size);
+}
+
+/*
+ * A vector's entry in VectorLiteRegistry; the registry owns it and supplies untrack.
+ * The vector keeps the fields current itself with relaxed stores, so reports can
+ * run on any thread without touching the vector, and a move never takes a lock.
+ */
+struct VectorLiteTrackerHook
+{
+    void (*untrack)(VectorLiteTrackerHook* self);
+    std::atomic<void*> vec { nullptr }; // the tracked object, updated when it moves
+    std::atomic<size_t> size { 0 };
+    std::atomic<size_t> capacity { 0 };
+};
 
 template <typename T>
 class VectorLite
@@ -9,17 +45,38 @@ class VectorLite
     public:
         VectorLite();
         VectorLite(size_t initialCapacity);
+        VectorLite(size_t initialCapacity, const VectorLiteAllocOptions& options); // aligned / NUMA-placed storage
         VectorLite(std::initializer_list<T> list); 
 
+        /* Takes ownership of ptr without copying. All `capacity` slots must hold
+           live objects (any bytes for trivial types); deleter(ptr, capacity) or
+           deleter(ptr) is called instead of destroying them when the buffer is
+           dropped, including when growth moves the elements elsewhere. */
+        template <typename Deleter>
+        static VectorLite<T> adopt(T* ptr, size_t size, size_t capacity, Deleter deleter);
+        static VectorLite<T> adopt(VectorLiteBuffer<T>&& buffer);
+
+        /* Gives up the buffer without copying; the vector is left empty with no storage */
+        VectorLiteBuffer<T> release();
+
+        T* data();
+        const T* data() const;
+
         /* RULE OF FIVE */
         ~VectorLite();
 
         VectorLite(const VectorLite<T>& other); //Copy Constructor
-        VectorLite(VectorLite<T>&& other) noexcept; //Move constructor
+        VectorLite(VectorLite<T>&& other) noexcept; //Move constructor, leaves other with capacity 0
 
         VectorLite<T>& operator=(const VectorLite<T>& rhs); //Copy assign
         VectorLite<T>& operator=(VectorLite<T>&& rhs) ; //Move assign
 
+        /* Evaluate a lazy expression in one pass; defined in VectorLiteExpr.h */
+        template <typename E>
+        VectorLite(const VectorLiteExpr<E>& expr);
+        template <typename E>
+        VectorLite<T>& operator=(const VectorLiteExpr<E>& expr);
+
         void push_back(const T& lvalue); 
         void push_back(T&& rvalue); 
         void pop_back();
@@ -39,7 +96,7 @@ class VectorLite
 
         bool empty() const;
 
-        void clear();
+        void clear(); // frees the buffer: capacity() is 0 until the next push_back or reserve
 
         bool operator==(const VectorLite<T>& rhs) const;
         bool operator!=(const VectorLite<T>& rhs) const;
@@ -53,6 +110,20 @@ class VectorLite
     
         void reserve(size_t newCapacity);
 
+        const VectorLiteAllocOptions& alloc_options() const;
+
+        /* Drops unused capacity (keeps at least one slot); adopted buffers are copied out and released */
+        void shrink_to_fit();
+
+        /* Opt-in memory accounting; track() is defined in VectorLiteRegistry.h. The entry
+           follows the vector through moves (construction and assignment, so relocated
+           elements stay tracked), but not through swaps or copies: swap() leaves it in
+           place, copies start untracked, and the destructor removes it. A tracked vector
+           publishes its size and capacity to the entry whenever they change. */
+        void track(const std::string& tag);
+        void untrack();
+        bool tracked() const;
+
         class iterator {
             private:
                 T* ptr;
@@ -107,39 +178,67 @@ class VectorLite
 
     private:
 
+        friend void vector_detail::set_size_unchecked<>(VectorLite<T>& vec, size_t size);
+
         static constexpr size_t default_capacity = 4; 
 
-        T* data;
+        VectorLiteAllocOptions allocOpts; // declared first: the elems initializer allocates with it
+        T* elems;
         size_t sz;
         size_t cap;
+        alloc_detail::BufferOwner<T>* owner; // set only for adopted buffers
+        VectorLiteTrackerHook* tracker; // set only while registered with VectorLiteRegistry
         
+        VectorLite(T* ptr, size_t size, size_t capacity, const VectorLiteAllocOptions& options,
+                   alloc_detail::BufferOwner<T>* bufferOwner);
+
+        T* allocate(size_t count) const;
         void destroy();
         void copyFrom(const VectorLite<T>& other);
         void double_capacity();
         void swap(VectorLite<T>& other) noexcept;
+        void publish() noexcept; // copies sz / cap into the registry entry; a no-op when untracked
 };
 
 // ============================== Definitions ==============================
 
 template <typename T>
 VectorLite<T>::VectorLite(): 
+    allocOpts {},
     sz { 0 }, 
     cap { default_capacity }, 
-    data { new T[default_capacity] }
+    elems { allocate(default_capacity) },
+    owner { nullptr },
+    tracker { nullptr }
 { }
 
 template <typename T>
 VectorLite<T>::VectorLite(size_t initialCapacity): 
+    allocOpts {},
+    sz { 0 }, 
+    cap { initialCapacity ? initialCapacity : 1 }, 
+    elems { allocate(initialCapacity ? initialCapacity : 1) },
+    owner { nullptr },
+    tracker { nullptr }
+{ }
+
+template <typename T>
+VectorLite<T>::VectorLite(size_t initialCapacity, const VectorLiteAllocOptions& options): 
+    allocOpts { options },
     sz { 0 }, 
     cap { initialCapacity ? initialCapacity : 1 }, 
-    data { new T[initialCapacity] }
+    elems { allocate(initialCapacity ? initialCapacity : 1) },
+    owner { nullptr },
+    tracker { nullptr }
 { }
 
 template <typename T>
 VectorLite<T>::VectorLite(std::initializer_list<T> initList):
 sz { 0 },
 cap { 0 },
-data { nullptr }
+elems { nullptr },
+owner { nullptr },
+tracker { nullptr }
 {
     VectorLite tmp;
     tmp.reserve(initList.size());
@@ -154,9 +253,11 @@ template <typename T>
 VectorLite<T>::VectorLite(const VectorLite<T>& other):
 sz { 0 }, 
 cap { 0 },
-data { nullptr } 
+elems { nullptr },
+owner { nullptr },
+tracker { nullptr }
 {
-    VectorLite tmp;
+    VectorLite tmp(default_capacity, other.allocOpts);
     tmp.reserve(other.size());
     for (const T& val : other)
     {
@@ -177,24 +278,37 @@ VectorLite<T>& VectorLite<T>::operator=(const VectorLite& rhs)
 template <typename T>
 VectorLite<T>& VectorLite<T>::operator=(VectorLite&& toMove) 
 { 
-    swap(toMove);
+    std::swap(tracker, toMove.tracker); // each entry stays with the contents it was tracking
+    if (tracker != nullptr)
+        tracker->vec.store(this, std::memory_order_relaxed);
+    if (toMove.tracker != nullptr)
+        toMove.tracker->vec.store(&toMove, std::memory_order_relaxed);
+    swap(toMove); // publishes both sides to their new entries
     return *this;
 }
 
 template <typename T>
 VectorLite<T>::VectorLite(VectorLite<T>&& other) noexcept:
+allocOpts { other.allocOpts },
 sz { other.sz }, 
 cap { other.cap },
-data { other.data } 
+elems { other.elems },
+owner { other.owner },
+tracker { other.tracker }
 {
-    other.data = nullptr;
+    other.elems = nullptr;
+    other.owner = nullptr;
     other.sz = 0;
-    other.cap = default_capacity;
+    other.cap = 0; // no storage left: the next push_back reallocates
+    other.tracker = nullptr;
+    if (tracker != nullptr)
+        tracker->vec.store(this, std::memory_order_relaxed); // size and capacity came along unchanged
 }
 
 template <typename T>
 VectorLite<T>::~VectorLite()
 {
+    untrack();
     destroy();
 }
 
@@ -203,7 +317,8 @@ void VectorLite<T>::push_back(const T& lvalue)
 {
     if (sz == cap)
         double_capacity();
-    data[sz++] = lvalue;
+    elems[sz++] = lvalue;
+    publish();
 }
 
 template <typename T>
@@ -211,13 +326,15 @@ void VectorLite<T>::push_back(T&& rvalue)
 {
     if (sz == cap)
         double_capacity();
-    data[sz++] = std::move(rvalue);
+    elems[sz++] = std::move(rvalue);
+    publish();
 }
 
 template <typename T>
 void VectorLite<T>::pop_back()
 {
     sz--;
+    publish();
 }
 
 template <typename T>
@@ -235,7 +352,7 @@ T& VectorLite<T>::at(size_t index)
 {
     if (index >= sz)
         throw std::out_of_range("Index out of bounds");
-    return data[index];
+    return elems[index];
 }
 
 template <typename T>
@@ -243,28 +360,98 @@ const T& VectorLite<T>::at(size_t index) const
 {
     if (index >= sz)
         throw std::out_of_range("Index out of bounds");
-    return data[index];
+    return elems[index];
 }
 
 template <typename T>
 T& VectorLite<T>::operator[](size_t index)
 {
-    return data[index];
+    return elems[index];
 }
 
 template <typename T>
 const T& VectorLite<T>::operator[](size_t index) const
 {
-    return data[index];
+    return elems[index];
+}
+
+template <typename T>
+VectorLite<T>::VectorLite(T* ptr, size_t size, size_t capacity, const VectorLiteAllocOptions& options,
+                          alloc_detail::BufferOwner<T>* bufferOwner):
+    allocOpts { options },
+    elems { ptr },
+    sz { size },
+    cap { capacity },
+    owner { bufferOwner },
+    tracker { nullptr }
+{ }
+
+template <typename T>
+template <typename Deleter>
+VectorLite<T> VectorLite<T>::adopt(T* ptr, size_t size, size_t capacity, Deleter deleter)
+{
+    if (ptr == nullptr || capacity == 0 || size > capacity)
+        throw std::invalid_argument("adopt needs a non-null buffer with size <= capacity");
+    auto* bufferOwner = new alloc_detail::CallableOwner<T, Deleter>(std::move(deleter));
+    return VectorLite<T>(ptr, size, capacity, VectorLiteAllocOptions{}, bufferOwner);
+}
+
+template <typename T>
+VectorLite<T> VectorLite<T>::adopt(VectorLiteBuffer<T>&& buffer)
+{
+    if (buffer.ptr == nullptr || buffer.capacity == 0 || buffer.size > buffer.capacity)
+        throw std::invalid_argument("adopt needs a non-null buffer with size <= capacity");
+    VectorLite<T> result(buffer.ptr, buffer.size, buffer.capacity, buffer.deleter.opts, buffer.deleter.owner);
+    buffer.deleter.owner = nullptr;
+    buffer.ptr = nullptr;
+    buffer.size = 0;
+    buffer.capacity = 0;
+    return result;
+}
+
+template <typename T>
+VectorLiteBuffer<T> VectorLite<T>::release()
+{
+    VectorLiteBuffer<T> buffer;
+    buffer.ptr = elems;
+    buffer.size = sz;
+    buffer.capacity = cap;
+    buffer.deleter = VectorLiteDeleter<T>(allocOpts, owner);
+    elems = nullptr;
+    sz = 0;
+    cap = 0;
+    owner = nullptr;
+    publish();
+    return buffer;
+}
+
+template <typename T>
+T* VectorLite<T>::data()
+{
+    return elems;
+}
+
+template <typename T>
+const T* VectorLite<T>::data() const
+{
+    return elems;
+}
+
+template <typename T>
+T* VectorLite<T>::allocate(size_t count) const
+{
+    return alloc_detail::allocate_elements<T>(count, allocOpts);
 }
 
 template <typename T>
 void VectorLite<T>::destroy()
 {
-    delete[] data;
+    VectorLiteDeleter<T>(allocOpts, owner)(elems, cap);
+    owner = nullptr;
     sz = 0;
-    cap = default_capacity;
-    data = nullptr;
+    cap = 0; // no storage left: the next push_back reallocates
+    elems = nullptr;
+    publish();
 }
 
 template <typename T>
@@ -288,10 +475,10 @@ bool VectorLite<T>::empty() const
 template <typename T>
 void VectorLite<T>::double_capacity()
 {
-    VectorLite<T> newVectorLite(cap * 2); 
+    VectorLite<T> newVectorLite(cap * 2, allocOpts); 
     for (size_t idx = 0; idx < sz; idx++)
     {
-        newVectorLite.data[idx] = std::move_if_noexcept(data[idx]);
+        newVectorLite.elems[idx] = std::move_if_noexcept(elems[idx]);
     }
     newVectorLite.sz = sz;
     swap(newVectorLite);
@@ -302,9 +489,22 @@ template <typename T>
 void VectorLite<T>::swap(VectorLite<T>& other) noexcept
 {
     using std::swap; 
+    swap(allocOpts, other.allocOpts);
+    swap(owner, other.owner);
     swap(cap, other.cap);
     swap(sz, other.sz);
-    swap(data, other.data);
+    swap(elems, other.elems);
+    publish();
+    other.publish();
+}
+
+template <typename T>
+void VectorLite<T>::publish() noexcept
+{
+    if (tracker == nullptr)
+        return;
+    tracker->size.store(sz, std::memory_order_relaxed);
+    tracker->capacity.store(cap, std::memory_order_relaxed);
 }
 
 template <typename T>
@@ -315,7 +515,7 @@ bool VectorLite<T>::operator==(const VectorLite<T>& rhs) const
 
     for (size_t i = 0; i < sz; i++)
     {
-        if(data[i] != rhs.data[i])
+        if(elems[i] != rhs.elems[i])
             return false;
     }
 
@@ -356,11 +556,11 @@ void VectorLite<T>::reserve(size_t newCapacity)
     if (cap >= newCapacity)
         return;
 
-    VectorLite<T> newVec(newCapacity);
+    VectorLite<T> newVec(newCapacity, allocOpts);
 
     for (size_t idx = 0; idx < sz; idx++)
     {
-        newVec[idx] = std::move_if_noexcept(data[idx]);
+        newVec[idx] = std::move_if_noexcept(elems[idx]);
     }
     newVec.sz = sz;
     swap(newVec);
@@ -368,17 +568,62 @@ void VectorLite<T>::reserve(size_t newCapacity)
 }
 
 template <typename T>
-typename VectorLite<T>::iterator VectorLite<T>::begin() { return iterator(data); }
+const VectorLiteAllocOptions& VectorLite<T>::alloc_options() const
+{
+    return allocOpts;
+}
+
+template <typename T>
+void VectorLite<T>::shrink_to_fit()
+{
+    const size_t fitted = sz ? sz : 1;
+    if (cap <= fitted)
+        return;
+
+    VectorLite<T> newVec(fitted, allocOpts);
+
+    for (size_t idx = 0; idx < sz; idx++)
+    {
+        newVec[idx] = std::move_if_noexcept(elems[idx]);
+    }
+    newVec.sz = sz;
+    swap(newVec);
+}
+
+template <typename T>
+void VectorLite<T>::untrack()
+{
+    if (tracker == nullptr)
+        return;
+    tracker->untrack(tracker);
+    tracker = nullptr;
+}
+
+template <typename T>
+bool VectorLite<T>::tracked() const
+{
+    return tracker != nullptr;
+}
+
+template <typename T>
+void vector_detail::set_size_unchecked(VectorLite<T>& vec, size_t size)
+{
+    vec.sz = size;
+    vec.publish();
+}
+
+template <typename T>
+typename VectorLite<T>::iterator VectorLite<T>::begin() { return iterator(elems); }
 
 template <typename T>
-typename VectorLite<T>::iterator VectorLite<T>::end() { return iterator(data + sz); }
+typename VectorLite<T>::iterator VectorLite<T>::end() { return iterator(elems + sz); }
 
 /* Read only access of const VectorLite*/
 template <typename T>
-typename VectorLite<T>::const_iterator VectorLite<T>::begin() const { return const_iterator(data); }
+typename VectorLite<T>::const_iterator VectorLite<T>::begin() const { return const_iterator(elems); }
 
 template <typename T>
-typename VectorLite<T>::const_iterator VectorLite<T>::end() const { return const_iterator(data + sz); }
+typename VectorLite<T>::const_iterator VectorLite<T>::end() const { return const_iterator(elems + sz); }
 
 
 /* Read only access of non const and const VectorLite*/
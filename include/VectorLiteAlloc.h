@@ -0,0 +1,324 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/* Where the kernel should place the pages of a large buffer (Linux only) */
+enum class NumaPolicy
+{
+    Default,    // whatever the process policy says, usually first touch
+    Local,      // the node of the thread that touches the page
+    Interleave, // round-robin over every node the process may use
+    Bind        // only the node in VectorLiteAllocOptions::node
+};
+
+/*
+ * Per-vector allocation options. They travel with the buffer, so a
+ * VectorLite keeps its alignment and placement across growth, copies and
+ * swaps.
+ */
+struct VectorLiteAllocOptions
+{
+    size_t alignment = 0;                 // 0 means alignof(T); otherwise a power of two (checked on allocation)
+    NumaPolicy numa = NumaPolicy::Default;
+    int node = -1;                        // node for NumaPolicy::Bind
+    size_t numaThreshold = size_t{1} << 20; // smaller buffers ignore the NUMA policy
+
+    static VectorLiteAllocOptions cache_aligned()
+    {
+        VectorLiteAllocOptions opts;
+        opts.alignment = 64;
+        return opts;
+    }
+
+    static VectorLiteAllocOptions page_aligned()
+    {
+        VectorLiteAllocOptions opts;
+        opts.alignment = 4096;
+        return opts;
+    }
+
+    static VectorLiteAllocOptions interleaved()
+    {
+        VectorLiteAllocOptions opts;
+        opts.alignment = 4096;
+        opts.numa = NumaPolicy::Interleave;
+        return opts;
+    }
+
+    static VectorLiteAllocOptions on_node(int numaNode)
+    {
+        VectorLiteAllocOptions opts;
+        opts.alignment = 4096;
+        opts.numa = NumaPolicy::Bind;
+        opts.node = numaNode;
+        return opts;
+    }
+
+    bool operator==(const VectorLiteAllocOptions& rhs) const
+    {
+        return alignment == rhs.alignment && numa == rhs.numa && node == rhs.node
+            && numaThreshold == rhs.numaThreshold;
+    }
+    bool operator!=(const VectorLiteAllocOptions& rhs) const { return !(*this == rhs); }
+};
+
+namespace alloc_detail
+{
+    constexpr size_t page_size = 4096;
+    constexpr unsigned long max_nodes = 1024;
+    constexpr size_t mask_words = max_nodes / (8 * sizeof(unsigned long));
+
+    /* From <linux/mempolicy.h>, spelled out so no kernel headers or libnuma are needed */
+    constexpr int mpol_bind = 2;
+    constexpr int mpol_interleave = 3;
+    constexpr int mpol_local = 4;
+    constexpr unsigned long mpol_f_mems_allowed = 1 << 2;
+
+    inline bool uses_mapping(size_t bytes, const VectorLiteAllocOptions& opts)
+    {
+#if defined(__linux__)
+        return opts.numa != NumaPolicy::Default && bytes >= opts.numaThreshold && opts.alignment <= page_size;
+#else
+        (void)bytes;
+        (void)opts;
+        return false;
+#endif
+    }
+
+    inline size_t round_to_pages(size_t bytes)
+    {
+        return (bytes + page_size - 1) / page_size * page_size;
+    }
+
+    /* Nodes this process may allocate on, as a get_mempolicy nodemask. Returns false if unsupported. */
+    inline bool allowed_nodes(unsigned long (&mask)[mask_words])
+    {
+        for (unsigned long& word : mask)
+            word = 0;
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+        int mode = 0;
+        return syscall(SYS_get_mempolicy, &mode, mask, max_nodes, nullptr, mpol_f_mems_allowed) == 0;
+#else
+        return false;
+#endif
+    }
+
+    inline int numa_node_count()
+    {
+        unsigned long mask[mask_words];
+        if (!allowed_nodes(mask))
+            return 1;
+        int nodes = 0;
+        for (unsigned long word : mask)
+            nodes += __builtin_popcountl(word);
+        return nodes ? nodes : 1;
+    }
+
+    /* Best effort: on kernels or sandboxes without mbind the pages simply stay on the default policy */
+    inline bool apply_policy(void* addr, size_t len, const VectorLiteAllocOptions& opts)
+    {
+#if defined(__linux__) && defined(SYS_mbind)
+        unsigned long mask[mask_words] = {};
+        int mode = mpol_local;
+        switch (opts.numa)
+        {
+            case NumaPolicy::Default:
+                return true;
+            case NumaPolicy::Local:
+                return syscall(SYS_mbind, addr, len, mpol_local, nullptr, 0, 0) == 0;
+            case NumaPolicy::Interleave:
+                mode = mpol_interleave;
+                if (!allowed_nodes(mask))
+                    return false;
+                break;
+            case NumaPolicy::Bind:
+                mode = mpol_bind;
+                if (opts.node < 0 || static_cast<unsigned long>(opts.node) >= max_nodes)
+                    return false;
+                mask[opts.node / (8 * sizeof(unsigned long))] |= 1UL << (opts.node % (8 * sizeof(unsigned long)));
+                break;
+        }
+        return syscall(SYS_mbind, addr, len, mode, mask, max_nodes, 0) == 0;
+#else
+        (void)addr;
+        (void)len;
+        (void)opts;
+        return false;
+#endif
+    }
+
+    /* Raw storage for a VectorLite buffer; throws std::bad_alloc like new T[] */
+    inline void* allocate_bytes(size_t bytes, size_t align, const VectorLiteAllocOptions& opts)
+    {
+        if (uses_mapping(bytes, opts))
+        {
+#if defined(__linux__)
+            void* addr = mmap(nullptr, round_to_pages(bytes), PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (addr == MAP_FAILED)
+                throw std::bad_alloc();
+            apply_policy(addr, round_to_pages(bytes), opts);
+            return addr;
+#endif
+        }
+        if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            return ::operator new(bytes, std::align_val_t(align));
+        return ::operator new(bytes);
+    }
+
+    inline void free_bytes(void* addr, size_t bytes, size_t align, const VectorLiteAllocOptions& opts)
+    {
+        if (uses_mapping(bytes, opts))
+        {
+#if defined(__linux__)
+            munmap(addr, round_to_pages(bytes));
+            return;
+#endif
+        }
+        if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            ::operator delete(addr, std::align_val_t(align));
+        else
+            ::operator delete(addr);
+    }
+
+    template <typename T>
+    constexpr size_t alignment_for(const VectorLiteAllocOptions& opts)
+    {
+        return opts.alignment > alignof(T) ? opts.alignment : alignof(T);
+    }
+
+    /* Same contract as new T[count]: every slot is default-initialized.
+       Throws std::invalid_argument if opts.alignment is neither 0 nor a power of two. */
+    template <typename T>
+    T* allocate_elements(size_t count, const VectorLiteAllocOptions& opts)
+    {
+        if (opts.alignment & (opts.alignment - 1))
+            throw std::invalid_argument("VectorLiteAllocOptions::alignment must be 0 or a power of two");
+        const size_t align = alignment_for<T>(opts);
+        T* ptr = static_cast<T*>(allocate_bytes(count * sizeof(T), align, opts));
+        size_t built = 0;
+        try
+        {
+            for (; built < count; built++)
+                ::new (static_cast<void*>(ptr + built)) T;
+        }
+        catch (...)
+        {
+            while (built > 0)
+                ptr[--built].~T();
+            free_bytes(ptr, count * sizeof(T), align, opts);
+            throw;
+        }
+        return ptr;
+    }
+
+    template <typename T>
+    void free_elements(T* ptr, size_t count, const VectorLiteAllocOptions& opts)
+    {
+        if (ptr == nullptr)
+            return;
+        if (!std::is_trivially_destructible<T>::value)
+        {
+            for (size_t idx = count; idx > 0; idx--)
+                ptr[idx - 1].~T();
+        }
+        free_bytes(ptr, count * sizeof(T), alignment_for<T>(opts), opts);
+    }
+
+    /* Type-erased owner of a buffer VectorLite did not allocate itself */
+    template <typename T>
+    struct BufferOwner
+    {
+        virtual ~BufferOwner() = default;
+        virtual void release(T* ptr, size_t capacity) = 0;
+    };
+
+    template <typename T, typename Deleter>
+    struct CallableOwner : BufferOwner<T>
+    {
+        Deleter deleter;
+
+        explicit CallableOwner(Deleter d) : deleter(std::move(d)) {}
+
+        /* Accepts deleter(ptr, capacity) (e.g. munmap wrappers) or plain deleter(ptr) */
+        void release(T* ptr, size_t capacity) override
+        {
+            if constexpr (std::is_invocable<Deleter&, T*, size_t>::value)
+                deleter(ptr, capacity);
+            else
+                deleter(ptr);
+        }
+    };
+}
+
+template <typename T>
+class VectorLite;
+
+/*
+ * Knows how to free one VectorLite buffer: either VectorLite's own
+ * allocation (with the options it was made with) or an adopted buffer's
+ * custom deleter. Move-only, since it may own the type-erased deleter.
+ */
+template <typename T>
+class VectorLiteDeleter
+{
+    public:
+        VectorLiteDeleter() : opts {}, owner { nullptr } {}
+        VectorLiteDeleter(const VectorLiteAllocOptions& options, alloc_detail::BufferOwner<T>* bufferOwner) :
+            opts { options }, owner { bufferOwner } {}
+
+        ~VectorLiteDeleter() { delete owner; }
+
+        VectorLiteDeleter(const VectorLiteDeleter<T>& other) = delete;
+        VectorLiteDeleter<T>& operator=(const VectorLiteDeleter<T>& rhs) = delete;
+
+        VectorLiteDeleter(VectorLiteDeleter<T>&& other) noexcept :
+            opts { other.opts }, owner { other.owner }
+        {
+            other.owner = nullptr;
+        }
+
+        VectorLiteDeleter<T>& operator=(VectorLiteDeleter<T>&& rhs) noexcept
+        {
+            std::swap(opts, rhs.opts);
+            std::swap(owner, rhs.owner);
+            return *this;
+        }
+
+        /* Destroys the elements (unless a custom deleter owns them) and frees the storage */
+        void operator()(T* ptr, size_t capacity)
+        {
+            if (ptr == nullptr)
+                return;
+            if (owner)
+                owner->release(ptr, capacity);
+            else
+                alloc_detail::free_elements(ptr, capacity, opts);
+        }
+
+    private:
+        friend class VectorLite<T>; // VectorLite::adopt takes the owner back
+
+        VectorLiteAllocOptions opts;
+        alloc_detail::BufferOwner<T>* owner;
+};
+
+/* A buffer handed out by VectorLite::release(); free it with deleter(ptr, capacity) or re-adopt it */
+template <typename T>
+struct VectorLiteBuffer
+{
+    T* ptr = nullptr;
+    size_t size = 0;
+    size_t capacity = 0;
+    VectorLiteDeleter<T> deleter;
+};
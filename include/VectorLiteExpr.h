@@ -0,0 +1,337 @@
+#pragma once
+
+#include "Vector.h"
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Lazy elementwise arithmetic over numeric VectorLites.
+ *
+ *     a = b * c + d;          // one loop, no temporary vectors
+ *     double s = vlexpr::sum(b * c);  // fused reduction
+ *
+ * Operators on VectorLite<arithmetic> (and on scalars broadcast against
+ * them) build a VectorLiteExpr tree of leaf pointers and operations; the
+ * work happens in a single loop when the tree is assigned to, or used to
+ * construct, a VectorLite. Leaves point into the operand vectors, so an
+ * expression must be consumed before any of its operands reallocate;
+ * keep it in the statement that builds it rather than storing it in auto.
+ *
+ * Elementwise equality is vlexpr::eq()/ne(), because VectorLite::operator==
+ * already compares whole vectors. The named functions (eq, ne and the
+ * reductions) live in namespace vlexpr; the operators stay global.
+ */
+template <typename E>
+class VectorLiteExpr
+{
+    public:
+        using value_type = typename E::value_type;
+
+        explicit VectorLiteExpr(const E& tree) : node(tree) {}
+
+        value_type operator[](size_t index) const { return node[index]; }
+        size_t size() const { return node.size(); }
+        const E& tree() const { return node; }
+
+        VectorLite<value_type> eval() const { return VectorLite<value_type>(*this); }
+
+    private:
+        E node;
+};
+
+namespace expr_detail
+{
+    struct Add      { template <typename A, typename B> auto operator()(A a, B b) const { return a + b; } };
+    struct Subtract { template <typename A, typename B> auto operator()(A a, B b) const { return a - b; } };
+    struct Multiply { template <typename A, typename B> auto operator()(A a, B b) const { return a * b; } };
+    struct Divide   { template <typename A, typename B> auto operator()(A a, B b) const { return a / b; } };
+    struct Less     { template <typename A, typename B> bool operator()(A a, B b) const { return a < b; } };
+    struct Greater  { template <typename A, typename B> bool operator()(A a, B b) const { return a > b; } };
+    struct LessEq   { template <typename A, typename B> bool operator()(A a, B b) const { return a <= b; } };
+    struct GreaterEq{ template <typename A, typename B> bool operator()(A a, B b) const { return a >= b; } };
+    struct Equal    { template <typename A, typename B> bool operator()(A a, B b) const { return a == b; } };
+    struct NotEqual { template <typename A, typename B> bool operator()(A a, B b) const { return a != b; } };
+    struct Negate   { template <typename A> auto operator()(A a) const { return -a; } };
+
+    /* Elements of a VectorLite, read through a raw pointer so the loop vectorizes */
+    template <typename T>
+    struct Leaf
+    {
+        using value_type = T;
+        static constexpr bool is_scalar = false;
+
+        const T* ptr;
+        size_t n;
+
+        T operator[](size_t index) const { return ptr[index]; }
+        size_t size() const { return n; }
+    };
+
+    /* A scalar broadcast to whatever length the other operand has */
+    template <typename S>
+    struct Scalar
+    {
+        using value_type = S;
+        static constexpr bool is_scalar = true;
+
+        S value;
+
+        S operator[](size_t) const { return value; }
+        size_t size() const { return 0; }
+    };
+
+    template <typename Op, typename A>
+    struct Unary
+    {
+        using value_type = decltype(Op{}(std::declval<typename A::value_type>()));
+        static constexpr bool is_scalar = false;
+
+        A arg;
+
+        value_type operator[](size_t index) const { return Op{}(arg[index]); }
+        size_t size() const { return arg.size(); }
+    };
+
+    template <typename Op, typename L, typename R>
+    struct Binary
+    {
+        using value_type = decltype(Op{}(std::declval<typename L::value_type>(), std::declval<typename R::value_type>()));
+        static constexpr bool is_scalar = false;
+
+        L lhs;
+        R rhs;
+        size_t n;
+
+        Binary(const L& left, const R& right) : lhs(left), rhs(right), n(combined_size(left, right)) {}
+
+        value_type operator[](size_t index) const { return Op{}(lhs[index], rhs[index]); }
+        size_t size() const { return n; }
+
+        static size_t combined_size(const L& left, const R& right)
+        {
+            if constexpr (L::is_scalar)
+                return right.size();
+            else if constexpr (R::is_scalar)
+                return left.size();
+            else
+            {
+                if (left.size() != right.size())
+                    throw std::invalid_argument("Expression operands differ in size");
+                return left.size();
+            }
+        }
+    };
+
+    template <typename T>
+    struct is_vector_operand : std::false_type {};
+
+    template <typename T>
+    struct is_vector_operand<VectorLite<T>> : std::is_arithmetic<T> {};
+
+    template <typename E>
+    struct is_vector_operand<VectorLiteExpr<E>> : std::true_type {};
+
+    template <typename T>
+    constexpr bool is_vector_operand_v = is_vector_operand<std::decay_t<T>>::value;
+
+    /* At least one side must be a vector; the other may be a vector or a scalar */
+    template <typename A, typename B>
+    constexpr bool is_binary_operand_v =
+        (is_vector_operand_v<A> || is_vector_operand_v<B>)
+        && (is_vector_operand_v<A> || std::is_arithmetic<std::decay_t<A>>::value)
+        && (is_vector_operand_v<B> || std::is_arithmetic<std::decay_t<B>>::value);
+
+    template <typename T>
+    Leaf<T> to_node(const VectorLite<T>& vec) { return Leaf<T>{ vec.data(), vec.size() }; }
+
+    template <typename E>
+    const E& to_node(const VectorLiteExpr<E>& expr) { return expr.tree(); }
+
+    template <typename S, typename = std::enable_if_t<std::is_arithmetic<S>::value>>
+    Scalar<S> to_node(S value) { return Scalar<S>{ value }; }
+
+    template <typename T>
+    using node_t = std::decay_t<decltype(to_node(std::declval<const std::decay_t<T>&>()))>;
+
+    template <typename Op, typename A, typename B>
+    VectorLiteExpr<Binary<Op, node_t<A>, node_t<B>>> make_binary(const A& a, const B& b)
+    {
+        using Node = Binary<Op, node_t<A>, node_t<B>>;
+        return VectorLiteExpr<Node>(Node(to_node(a), to_node(b)));
+    }
+
+    /* The fused loop: every element of the tree is computed straight into out */
+    template <typename T, typename E>
+    void evaluate(T* out, const E& node, size_t count)
+    {
+        for (size_t idx = 0; idx < count; idx++)
+            out[idx] = static_cast<T>(node[idx]);
+    }
+}
+
+#define VECTORLITE_EXPR_BINARY(OP, NAME)                                                         \
+    template <typename A, typename B, typename = std::enable_if_t<expr_detail::is_binary_operand_v<A, B>>> \
+    auto OP(const A& a, const B& b)                                                              \
+    {                                                                                            \
+        return expr_detail::make_binary<expr_detail::NAME>(a, b);                                \
+    }
+
+VECTORLITE_EXPR_BINARY(operator+, Add)
+VECTORLITE_EXPR_BINARY(operator-, Subtract)
+VECTORLITE_EXPR_BINARY(operator*, Multiply)
+VECTORLITE_EXPR_BINARY(operator/, Divide)
+VECTORLITE_EXPR_BINARY(operator<, Less)
+VECTORLITE_EXPR_BINARY(operator>, Greater)
+VECTORLITE_EXPR_BINARY(operator<=, LessEq)
+VECTORLITE_EXPR_BINARY(operator>=, GreaterEq)
+
+/* Named functions live in vlexpr so they cannot collide with user count()/all() and the like */
+namespace vlexpr
+{
+    VECTORLITE_EXPR_BINARY(eq, Equal)
+    VECTORLITE_EXPR_BINARY(ne, NotEqual)
+}
+
+#undef VECTORLITE_EXPR_BINARY
+
+template <typename A, typename = std::enable_if_t<expr_detail::is_vector_operand_v<A>>>
+auto operator-(const A& a)
+{
+    using Node = expr_detail::Unary<expr_detail::Negate, expr_detail::node_t<A>>;
+    return VectorLiteExpr<Node>(Node{ expr_detail::to_node(a) });
+}
+
+/* ----- Reductions: one pass over the tree, nothing materialized ----- */
+
+namespace vlexpr
+{
+    /* Four independent accumulators so the loop can vectorize; the rounding differs from a strict left fold */
+    template <typename A, typename = std::enable_if_t<expr_detail::is_vector_operand_v<A>>>
+    auto sum(const A& a)
+    {
+        const auto node = expr_detail::to_node(a);
+        using Value = typename std::decay_t<decltype(node)>::value_type;
+        using Acc = decltype(std::declval<Value>() + std::declval<Value>());
+        const size_t n = node.size();
+        Acc acc0 {}, acc1 {}, acc2 {}, acc3 {};
+        size_t idx = 0;
+        for (; idx + 4 <= n; idx += 4)
+        {
+            acc0 += node[idx];
+            acc1 += node[idx + 1];
+            acc2 += node[idx + 2];
+            acc3 += node[idx + 3];
+        }
+        for (; idx < n; idx++)
+            acc0 += node[idx];
+        return (acc0 + acc1) + (acc2 + acc3);
+    }
+
+    template <typename A, typename B, typename = std::enable_if_t<expr_detail::is_vector_operand_v<A>
+                                                                && expr_detail::is_vector_operand_v<B>>>
+    auto dot(const A& a, const B& b)
+    {
+        return sum(a * b);
+    }
+
+    /* Throws std::invalid_argument on an empty expression */
+    template <typename A, typename = std::enable_if_t<expr_detail::is_vector_operand_v<A>>>
+    auto minimum(const A& a)
+    {
+        const auto node = expr_detail::to_node(a);
+        if (node.size() == 0)
+            throw std::invalid_argument("Reduction of an empty expression");
+        auto best = node[0];
+        for (size_t idx = 1; idx < node.size(); idx++)
+        {
+            auto value = node[idx];
+            best = value < best ? value : best;
+        }
+        return best;
+    }
+
+    /* Throws std::invalid_argument on an empty expression */
+    template <typename A, typename = std::enable_if_t<expr_detail::is_vector_operand_v<A>>>
+    auto maximum(const A& a)
+    {
+        const auto node = expr_detail::to_node(a);
+        if (node.size() == 0)
+            throw std::invalid_argument("Reduction of an empty expression");
+        auto best = node[0];
+        for (size_t idx = 1; idx < node.size(); idx++)
+        {
+            auto value = node[idx];
+            best = value > best ? value : best;
+        }
+        return best;
+    }
+
+    /* Number of nonzero (true) elements, e.g. count(a > 0.5) */
+    template <typename A, typename = std::enable_if_t<expr_detail::is_vector_operand_v<A>>>
+    size_t count(const A& a)
+    {
+        const auto node = expr_detail::to_node(a);
+        size_t total = 0;
+        for (size_t idx = 0; idx < node.size(); idx++)
+            total += node[idx] ? 1 : 0;
+        return total;
+    }
+
+    template <typename A, typename = std::enable_if_t<expr_detail::is_vector_operand_v<A>>>
+    bool any(const A& a)
+    {
+        const auto node = expr_detail::to_node(a);
+        for (size_t idx = 0; idx < node.size(); idx++)
+        {
+            if (node[idx])
+                return true;
+        }
+        return false;
+    }
+
+    template <typename A, typename = std::enable_if_t<expr_detail::is_vector_operand_v<A>>>
+    bool all(const A& a)
+    {
+        const auto node = expr_detail::to_node(a);
+        for (size_t idx = 0; idx < node.size(); idx++)
+        {
+            if (!node[idx])
+                return false;
+        }
+        return true;
+    }
+}
+
+// ============================== VectorLite hooks ==============================
+
+template <typename T>
+template <typename E>
+VectorLite<T>::VectorLite(const VectorLiteExpr<E>& expr):
+    VectorLite(expr.size())
+{
+    expr_detail::evaluate(elems, expr.tree(), expr.size());
+    sz = expr.size();
+}
+
+/* Reuses the current buffer when it is big enough; a = a * b is safe since element i only reads index i */
+template <typename T>
+template <typename E>
+VectorLite<T>& VectorLite<T>::operator=(const VectorLiteExpr<E>& expr)
+{
+    const size_t n = expr.size();
+    if (cap < n)
+    {
+        VectorLite<T> result(n, allocOpts);
+        expr_detail::evaluate(result.elems, expr.tree(), n);
+        result.sz = n;
+        swap(result);
+    }
+    else
+    {
+        expr_detail::evaluate(elems, expr.tree(), n);
+        sz = n;
+    }
+    return *this;
+}
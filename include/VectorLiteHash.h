@@ -0,0 +1,342 @@
+#pragma once
+
+#include "Vector.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * Hashing for VectorLite:
+ *
+ *  - std::hash<VectorLite<T>>, so vectors can key unordered containers.
+ *    Element types whose equal values have equal bytes (integers, enums,
+ *    pointers, padding-free structs) are hashed as one block of memory;
+ *    anything else (floats, strings, nested vectors) is folded element by
+ *    element with hash_combine.
+ *  - hash_combine(seed, value), the usual boost-style mixer.
+ *  - dedup()/unique(): drop repeats in O(n) expected time, keeping the
+ *    first occurrence and the original order.
+ *  - batch_hash(): hashes every row of a VectorLite<VectorLite<T>> on
+ *    several threads.
+ *
+ * hash_combine, dedup, unique and batch_hash live in namespace vlhash, so
+ * they never meet std::unique or a user's own helpers in overload
+ * resolution; only the std::hash specialization is outside it.
+ */
+
+namespace hash_detail
+{
+    /* wyhash-style constants and 64x64->128 multiply-fold mixing (public domain construction) */
+    constexpr uint64_t secret0 = 0xa0761d6478bd642full;
+    constexpr uint64_t secret1 = 0xe7037ed1a0b428dbull;
+    constexpr uint64_t secret2 = 0x8ebc6af09c88c6e3ull;
+    constexpr uint64_t secret3 = 0x589965cc75374cc3ull;
+
+    /* 64x64->128 multiply from 32-bit halves, for compilers without __uint128_t */
+    inline void multiply_128_portable(uint64_t a, uint64_t b, uint64_t& lo, uint64_t& hi)
+    {
+        const uint64_t aLo = a & 0xffffffffull;
+        const uint64_t aHi = a >> 32;
+        const uint64_t bLo = b & 0xffffffffull;
+        const uint64_t bHi = b >> 32;
+        const uint64_t lowLow = aLo * bLo;
+        const uint64_t lowHigh = aLo * bHi;
+        const uint64_t highLow = aHi * bLo;
+        const uint64_t middle = (lowLow >> 32) + (lowHigh & 0xffffffffull) + (highLow & 0xffffffffull);
+        lo = (middle << 32) | (lowLow & 0xffffffffull);
+        hi = aHi * bHi + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+    }
+
+    inline void multiply_128(uint64_t a, uint64_t b, uint64_t& lo, uint64_t& hi)
+    {
+#ifdef __SIZEOF_INT128__
+        const __uint128_t product = static_cast<__uint128_t>(a) * b;
+        lo = static_cast<uint64_t>(product);
+        hi = static_cast<uint64_t>(product >> 64);
+#else
+        multiply_128_portable(a, b, lo, hi);
+#endif
+    }
+
+    inline uint64_t mix(uint64_t a, uint64_t b)
+    {
+        uint64_t lo;
+        uint64_t hi;
+        multiply_128(a, b, lo, hi);
+        return lo ^ hi;
+    }
+
+    inline uint64_t read64(const unsigned char* p)
+    {
+        uint64_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t read32(const unsigned char* p)
+    {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    /* Fast non-cryptographic hash of len bytes; consumes 48 bytes per round with three independent lanes */
+    inline uint64_t hash_bytes(const void* key, size_t len, uint64_t seed)
+    {
+        const unsigned char* p = static_cast<const unsigned char*>(key);
+        seed ^= mix(seed ^ secret0, secret1);
+        uint64_t a = 0;
+        uint64_t b = 0;
+        if (len <= 16)
+        {
+            if (len >= 4)
+            {
+                const size_t shift = (len >> 3) << 2;
+                a = (read32(p) << 32) | read32(p + shift);
+                b = (read32(p + len - 4) << 32) | read32(p + len - 4 - shift);
+            }
+            else if (len > 0)
+            {
+                a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[len >> 1]) << 8) | p[len - 1];
+            }
+        }
+        else
+        {
+            size_t remaining = len;
+            if (remaining > 48)
+            {
+                uint64_t lane1 = seed;
+                uint64_t lane2 = seed;
+                do
+                {
+                    seed = mix(read64(p) ^ secret1, read64(p + 8) ^ seed);
+                    lane1 = mix(read64(p + 16) ^ secret2, read64(p + 24) ^ lane1);
+                    lane2 = mix(read64(p + 32) ^ secret3, read64(p + 40) ^ lane2);
+                    p += 48;
+                    remaining -= 48;
+                } while (remaining > 48);
+                seed ^= lane1 ^ lane2;
+            }
+            while (remaining > 16)
+            {
+                seed = mix(read64(p) ^ secret1, read64(p + 8) ^ seed);
+                p += 16;
+                remaining -= 16;
+            }
+            a = read64(p + remaining - 16);
+            b = read64(p + remaining - 8);
+        }
+        a ^= secret1;
+        b ^= seed;
+        multiply_128(a, b, a, b);
+        return mix(a ^ secret0 ^ len, b ^ secret1);
+    }
+
+    /* Equal values are guaranteed to have equal bytes, so hashing the bytes is sound */
+    template <typename T>
+    constexpr bool bytewise_hashable = std::has_unique_object_representations<T>::value;
+
+    /*
+     * Scratch table for dedup: open addressing with linear probing, kept at
+     * most half full. It starts small and doubles as distinct elements
+     * arrive, so heavy-duplicate inputs stay cache-resident. Slots remember
+     * an element's position and full hash, so most mismatches never touch
+     * the element itself and growth never rehashes elements.
+     */
+    class SeenTable
+    {
+        public:
+            SeenTable() : used { 0 }
+            {
+                rebuild(initial_bits);
+            }
+
+            /* Records pos unless an equal element is already present; same(pos) compares against it */
+            template <typename Same>
+            bool insert(size_t hash, size_t pos, Same same)
+            {
+                size_t idx = home(hash);
+                while (true)
+                {
+                    Slot& slot = slots[idx];
+                    if (slot.pos == empty)
+                        break;
+                    if (slot.hash == hash && same(slot.pos))
+                        return false;
+                    idx = (idx + 1) & mask;
+                }
+                slots[idx] = Slot{ hash, pos };
+                if (++used * 2 > slots.size())
+                    grow();
+                return true;
+            }
+
+        private:
+            struct Slot
+            {
+                size_t hash;
+                size_t pos;
+            };
+
+            static constexpr size_t empty = static_cast<size_t>(-1);
+            static constexpr unsigned initial_bits = 10;
+
+            VectorLite<Slot> slots;
+            size_t mask;
+            unsigned shift;
+            size_t used;
+
+            /* Fibonacci hashing spreads identity hashes such as std::hash<int> over the table */
+            size_t home(size_t hash) const
+            {
+                return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9e3779b97f4a7c15ull) >> shift);
+            }
+
+            void rebuild(unsigned bits)
+            {
+                const size_t capacity = size_t{1} << bits;
+                VectorLite<Slot> fresh(capacity);
+                for (size_t idx = 0; idx < capacity; idx++)
+                    fresh.push_back(Slot{ 0, empty });
+                swap(slots, fresh);
+                mask = capacity - 1;
+                shift = 64 - bits;
+            }
+
+            void grow()
+            {
+                VectorLite<Slot> old(std::move(slots));
+                rebuild(64 - shift + 1);
+                for (const Slot& slot : old)
+                {
+                    if (slot.pos == empty)
+                        continue;
+                    size_t idx = home(slot.hash);
+                    while (slots[idx].pos != empty)
+                        idx = (idx + 1) & mask;
+                    slots[idx] = slot;
+                }
+            }
+    };
+}
+
+namespace vlhash
+{
+    template <typename V>
+    void hash_combine(size_t& seed, const V& value)
+    {
+        seed ^= std::hash<V>{}(value) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+    }
+}
+
+namespace std
+{
+    template <typename T>
+    struct hash<VectorLite<T>>
+    {
+        size_t operator()(const VectorLite<T>& vec) const
+        {
+            if constexpr (hash_detail::bytewise_hashable<T>)
+            {
+                return static_cast<size_t>(hash_detail::hash_bytes(vec.data(), vec.size() * sizeof(T), vec.size()));
+            }
+            else
+            {
+                size_t seed = vec.size();
+                for (const T& value : vec)
+                    vlhash::hash_combine(seed, value);
+                return seed;
+            }
+        }
+    };
+}
+
+namespace vlhash
+{
+    /* Removes repeated elements in place, keeping each first occurrence in order. Returns how many were removed. */
+    template <typename T, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>>
+    size_t dedup(VectorLite<T>& vec, Hash hasher = Hash{}, Equal equal = Equal{})
+    {
+        const size_t n = vec.size();
+        if (n < 2)
+            return 0;
+        hash_detail::SeenTable seen;
+        size_t kept = 0;
+        for (size_t idx = 0; idx < n; idx++)
+        {
+            const bool first = seen.insert(hasher(vec[idx]), kept,
+                                           [&](size_t pos) { return equal(vec[pos], vec[idx]); });
+            if (first)
+            {
+                if (kept != idx)
+                    vec[kept] = std::move(vec[idx]);
+                kept++;
+            }
+        }
+        for (size_t idx = kept; idx < n; idx++)
+            vec.pop_back();
+        return n - kept;
+    }
+
+    /* Copy of vec without repeats, keeping each first occurrence in order */
+    template <typename T, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>>
+    VectorLite<T> unique(const VectorLite<T>& vec, Hash hasher = Hash{}, Equal equal = Equal{})
+    {
+        VectorLite<T> result(vec.size());
+        hash_detail::SeenTable seen;
+        for (const T& value : vec)
+        {
+            if (seen.insert(hasher(value), result.size(), [&](size_t pos) { return equal(result[pos], value); }))
+                result.push_back(value);
+        }
+        return result;
+    }
+
+    /*
+     * std::hash of every row, computed on `threads` threads (0 means one per
+     * hardware thread). Rows are split into contiguous ranges; small batches
+     * are hashed on the calling thread.
+     */
+    template <typename T>
+    VectorLite<size_t> batch_hash(const VectorLite<VectorLite<T>>& rows, unsigned threads = 0)
+    {
+        static constexpr size_t min_rows_per_thread = 1024;
+
+        const size_t n = rows.size();
+        VectorLite<size_t> hashes(n);
+        for (size_t idx = 0; idx < n; idx++)
+            hashes.push_back(0);
+
+        if (threads == 0)
+            threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+        size_t workers = n / min_rows_per_thread;
+        if (workers > threads)
+            workers = threads;
+
+        size_t* out = hashes.data();
+        auto hash_range = [&rows, out](size_t begin, size_t end) {
+            std::hash<VectorLite<T>> hasher;
+            for (size_t idx = begin; idx < end; idx++)
+                out[idx] = hasher(rows[idx]);
+        };
+
+        if (workers <= 1)
+        {
+            hash_range(0, n);
+            return hashes;
+        }
+        std::vector<std::thread> pool;
+        pool.reserve(workers - 1);
+        for (size_t w = 1; w < workers; w++)
+            pool.emplace_back(hash_range, n * w / workers, n * (w + 1) / workers);
+        hash_range(0, n / workers);
+        for (std::thread& th : pool)
+            th.join();
+        return hashes;
+    }
+}
@@ -0,0 +1,823 @@
+#pragma once
+
+#include "Vector.h"
+#include <cerrno>
+#include <charconv>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if __has_include(<linux/io_uring.h>) && defined(SYS_io_uring_setup)
+#include <linux/io_uring.h>
+#define VECTORLITE_HAVE_IO_URING 1
+#endif
+#endif
+
+/*
+ * Streaming file loader for VectorLite.
+ *
+ * The file is read in fixed-size chunks, `threads` chunks per batch, with
+ * two batch buffers: while the workers parse batch i, the reads for batch
+ * i+1 are already in flight (io_uring through raw syscalls, or pread on
+ * helper threads where io_uring is unavailable). Each parsed batch is
+ * appended to the target with at most one reservation.
+ *
+ *     VectorLiteLoader loader;
+ *     VectorLite<int64_t> ids;
+ *     loader.load_lines(ids, "ids.txt");            // one number per line
+ *     loader.load_binary(samples, "samples.f32");   // raw little-endian records
+ */
+enum class LoaderBackend
+{
+    Auto,    // io_uring when the kernel allows it, otherwise pread
+    IoUring, // io_uring or throw std::system_error
+    Pread    // pread on helper threads
+};
+
+struct LoaderOptions
+{
+    size_t chunkBytes = size_t{1} << 20; // bytes per read request; also the longest allowed line
+    unsigned threads = 0;                // parse workers and reads per batch; 0 means one per hardware thread
+    LoaderBackend backend = LoaderBackend::Auto;
+};
+
+struct LoaderStats
+{
+    size_t bytes = 0;   // bytes read from the file
+    size_t records = 0; // elements appended to the target
+    size_t batches = 0;
+    LoaderBackend backend = LoaderBackend::Pread; // the backend that actually did the reads
+};
+
+namespace loader_detail
+{
+    class FileHandle
+    {
+        public:
+            explicit FileHandle(const std::string& path) : fd { ::open(path.c_str(), O_RDONLY | O_CLOEXEC) }
+            {
+                if (fd < 0)
+                    throw std::system_error(errno, std::generic_category(), "open " + path);
+            }
+
+            ~FileHandle() { ::close(fd); }
+
+            FileHandle(const FileHandle& other) = delete;
+            FileHandle& operator=(const FileHandle& rhs) = delete;
+
+            int get() const { return fd; }
+
+            size_t size() const
+            {
+                struct stat info;
+                if (::fstat(fd, &info) != 0)
+                    throw std::system_error(errno, std::generic_category(), "fstat");
+                return static_cast<size_t>(info.st_size);
+            }
+
+        private:
+            int fd;
+    };
+
+    struct ReadRequest
+    {
+        char* buf;
+        size_t len;
+        uint64_t offset;
+        size_t done;
+    };
+
+    /* Jobs submitted together; wait() blocks until all of them ran, then rethrows the first failure */
+    class JobGroup
+    {
+        public:
+            JobGroup() : pending { 0 } {}
+            ~JobGroup() // never leaves a job running against the caller's stack
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                done.wait(lock, [this] { return pending == 0; });
+            }
+            JobGroup(const JobGroup&) = delete;
+            JobGroup& operator=(const JobGroup&) = delete;
+
+            void wait()
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                done.wait(lock, [this] { return pending == 0; });
+                if (failure)
+                {
+                    std::exception_ptr first = failure;
+                    failure = nullptr;
+                    std::rethrow_exception(first);
+                }
+            }
+
+        private:
+            friend class WorkerPool;
+
+            std::mutex mtx;
+            std::condition_variable done;
+            size_t pending;
+            std::exception_ptr failure;
+    };
+
+    /* A fixed set of threads fed from one queue, started once and joined on destruction */
+    class WorkerPool
+    {
+        public:
+            explicit WorkerPool(unsigned threads) : stopping { false }
+            {
+                for (unsigned t = 0; t < threads; t++)
+                    workers.emplace_back([this] { run(); });
+            }
+
+            ~WorkerPool()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mtx);
+                    stopping = true;
+                }
+                ready.notify_all();
+                for (std::thread& worker : workers)
+                    worker.join();
+            }
+
+            WorkerPool(const WorkerPool&) = delete;
+            WorkerPool& operator=(const WorkerPool&) = delete;
+
+            void submit(JobGroup& group, std::function<void()> work)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(group.mtx);
+                    group.pending++;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mtx);
+                    queue.push_back(Job { &group, std::move(work) });
+                }
+                ready.notify_one();
+            }
+
+        private:
+            struct Job
+            {
+                JobGroup* group;
+                std::function<void()> work;
+            };
+
+            std::mutex mtx;
+            std::condition_variable ready;
+            std::deque<Job> queue;
+            bool stopping;
+            std::vector<std::thread> workers;
+
+            void run()
+            {
+                for (;;)
+                {
+                    Job job;
+                    {
+                        std::unique_lock<std::mutex> lock(mtx);
+                        ready.wait(lock, [this] { return stopping || !queue.empty(); });
+                        if (queue.empty())
+                            return;
+                        job = std::move(queue.front());
+                        queue.pop_front();
+                    }
+
+                    std::exception_ptr failure;
+                    try
+                    {
+                        job.work();
+                    }
+                    catch (...)
+                    {
+                        failure = std::current_exception();
+                    }
+                    job.work = nullptr; // drop the captures before the group can be released
+
+                    // notify under the lock: the waiter may destroy the group as soon as it sees zero
+                    std::lock_guard<std::mutex> lock(job.group->mtx);
+                    if (failure && !job.group->failure)
+                        job.group->failure = failure;
+                    if (--job.group->pending == 0)
+                        job.group->done.notify_all();
+                }
+            }
+    };
+
+    /* Runs one batch of reads at a time: start() returns at once, finish() blocks until every read is complete */
+    class ReadEngine
+    {
+        public:
+            virtual ~ReadEngine() = default;
+            virtual void start(int fd, ReadRequest* reqs, size_t count) = 0;
+            virtual void finish() = 0;
+    };
+
+    inline void pread_fully(int fd, ReadRequest& req)
+    {
+        while (req.done < req.len)
+        {
+            ssize_t got = ::pread(fd, req.buf + req.done, req.len - req.done, static_cast<off_t>(req.offset + req.done));
+            if (got < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                throw std::system_error(errno, std::generic_category(), "pread");
+            }
+            if (got == 0)
+                throw std::runtime_error("File ended before the expected size");
+            req.done += static_cast<size_t>(got);
+        }
+    }
+
+    /* Reads on a pool sized to one batch, so no thread is started per read */
+    class PreadEngine : public ReadEngine
+    {
+        public:
+            explicit PreadEngine(unsigned threads) : pool { threads } {}
+
+            void start(int fd, ReadRequest* reqs, size_t count) override
+            {
+                for (size_t idx = 0; idx < count; idx++)
+                {
+                    ReadRequest* req = reqs + idx;
+                    pool.submit(reads, [fd, req] { pread_fully(fd, *req); });
+                }
+            }
+
+            /* Waits for every read, even after a failure, so no thread still writes into the caller's buffers */
+            void finish() override
+            {
+                reads.wait();
+            }
+
+        private:
+            JobGroup reads; // declared first so it is destroyed after the pool has joined
+            WorkerPool pool;
+    };
+
+#if defined(VECTORLITE_HAVE_IO_URING)
+    /*
+     * Minimal io_uring client: one submission and one completion ring
+     * mapped from the kernel, IORING_OP_READ only, no liburing. The
+     * loader is the only producer and consumer, so plain acquire/release
+     * accesses to the shared head/tail indices are enough.
+     */
+    class UringEngine : public ReadEngine
+    {
+        public:
+            explicit UringEngine(unsigned depth)
+            {
+                unsigned entries = 8;
+                while (entries < depth)
+                    entries <<= 1;
+
+                io_uring_params params;
+                std::memset(&params, 0, sizeof(params));
+                ringFd = static_cast<int>(syscall(SYS_io_uring_setup, entries, &params));
+                if (ringFd < 0)
+                    throw std::system_error(errno, std::generic_category(), "io_uring_setup");
+                try
+                {
+                    map_rings(params);
+                    require_read_opcode();
+                }
+                catch (...)
+                {
+                    teardown();
+                    throw;
+                }
+            }
+
+            ~UringEngine() override { teardown(); }
+
+            UringEngine(const UringEngine& other) = delete;
+            UringEngine& operator=(const UringEngine& rhs) = delete;
+
+            void start(int fd, ReadRequest* reqs, size_t count) override
+            {
+                batch = reqs;
+                fileFd = fd;
+                inFlight = 0;
+                for (size_t idx = 0; idx < count; idx++)
+                    queue_read(idx);
+                submit(static_cast<unsigned>(count));
+            }
+
+            /* Short reads are resubmitted for the remainder; all completions are reaped before an error is thrown */
+            void finish() override
+            {
+                int error = 0;
+                bool ended = false;
+                while (inFlight > 0)
+                {
+                    unsigned head = *cqHead;
+                    unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+                    if (head == tail)
+                    {
+                        enter(0, 1, IORING_ENTER_GETEVENTS);
+                        continue;
+                    }
+                    unsigned resubmits = 0;
+                    for (; head != tail; head++)
+                    {
+                        const io_uring_cqe& cqe = cqes[head & *cqMask];
+                        ReadRequest& req = batch[cqe.user_data];
+                        inFlight--;
+                        if (cqe.res < 0)
+                            error = error ? error : -cqe.res;
+                        else if (cqe.res == 0)
+                            ended = true;
+                        else
+                        {
+                            req.done += static_cast<size_t>(cqe.res);
+                            if (req.done < req.len && !error && !ended)
+                            {
+                                queue_read(cqe.user_data);
+                                resubmits++;
+                            }
+                        }
+                    }
+                    __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+                    if (resubmits)
+                        submit(resubmits);
+                }
+                if (error)
+                    throw std::system_error(error, std::generic_category(), "io_uring read");
+                if (ended)
+                    throw std::runtime_error("File ended before the expected size");
+            }
+
+        private:
+            int ringFd = -1;
+            int fileFd = -1;
+            void* sqMap = nullptr;
+            size_t sqMapLen = 0;
+            void* cqMap = nullptr;
+            size_t cqMapLen = 0;
+            io_uring_sqe* sqes = nullptr;
+            size_t sqesLen = 0;
+            unsigned* sqTail = nullptr;
+            unsigned* sqMask = nullptr;
+            unsigned* sqArray = nullptr;
+            unsigned* cqHead = nullptr;
+            unsigned* cqTail = nullptr;
+            unsigned* cqMask = nullptr;
+            io_uring_cqe* cqes = nullptr;
+            ReadRequest* batch = nullptr;
+            size_t inFlight = 0;
+
+            void map_rings(const io_uring_params& params)
+            {
+                sqMapLen = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+                cqMapLen = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+                const bool single = params.features & IORING_FEAT_SINGLE_MMAP;
+                if (single)
+                    sqMapLen = cqMapLen = sqMapLen > cqMapLen ? sqMapLen : cqMapLen;
+
+                sqMap = map(sqMapLen, IORING_OFF_SQ_RING);
+                cqMap = single ? sqMap : map(cqMapLen, IORING_OFF_CQ_RING);
+                sqesLen = params.sq_entries * sizeof(io_uring_sqe);
+                sqes = static_cast<io_uring_sqe*>(map(sqesLen, IORING_OFF_SQES));
+
+                char* sq = static_cast<char*>(sqMap);
+                sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+                sqMask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+                sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+                char* cq = static_cast<char*>(cqMap);
+                cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+                cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+                cqMask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+                cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+            }
+
+            void* map(size_t len, uint64_t offset)
+            {
+                void* addr = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd,
+                                  static_cast<off_t>(offset));
+                if (addr == MAP_FAILED)
+                    throw std::system_error(errno, std::generic_category(), "mmap io_uring");
+                return addr;
+            }
+
+            /* IORING_OP_READ needs Linux 5.6; older kernels take the pread path instead */
+            void require_read_opcode()
+            {
+                constexpr unsigned ops = 256;
+                std::vector<char> storage(sizeof(io_uring_probe) + ops * sizeof(io_uring_probe_op), 0);
+                io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+                if (syscall(SYS_io_uring_register, ringFd, IORING_REGISTER_PROBE, probe, ops) < 0)
+                    throw std::system_error(errno, std::generic_category(), "io_uring probe");
+                if (probe->last_op < IORING_OP_READ || !(probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED))
+                    throw std::system_error(ENOSYS, std::generic_category(), "io_uring without IORING_OP_READ");
+            }
+
+            void teardown()
+            {
+                if (sqes)
+                    munmap(sqes, sqesLen);
+                if (cqMap && cqMap != sqMap)
+                    munmap(cqMap, cqMapLen);
+                if (sqMap)
+                    munmap(sqMap, sqMapLen);
+                if (ringFd >= 0)
+                    ::close(ringFd);
+                sqes = nullptr;
+                cqMap = sqMap = nullptr;
+                ringFd = -1;
+            }
+
+            void queue_read(uint64_t index)
+            {
+                ReadRequest& req = batch[index];
+                const unsigned tail = *sqTail;
+                const unsigned slot = tail & *sqMask;
+                io_uring_sqe& sqe = sqes[slot];
+                std::memset(&sqe, 0, sizeof(sqe));
+                sqe.opcode = IORING_OP_READ;
+                sqe.fd = fileFd;
+                sqe.addr = reinterpret_cast<uint64_t>(req.buf + req.done);
+                sqe.len = static_cast<uint32_t>(req.len - req.done);
+                sqe.off = req.offset + req.done;
+                sqe.user_data = index;
+                sqArray[slot] = slot;
+                __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+                inFlight++;
+            }
+
+            /* On failure the unsubmitted entries are taken back off the ring so finish() only waits for real reads */
+            void submit(unsigned count)
+            {
+                try
+                {
+                    while (count > 0)
+                        count -= static_cast<unsigned>(enter(count, 0, 0));
+                }
+                catch (...)
+                {
+                    __atomic_store_n(sqTail, *sqTail - count, __ATOMIC_RELEASE);
+                    inFlight -= count;
+                    throw;
+                }
+            }
+
+            int enter(unsigned toSubmit, unsigned minComplete, unsigned flags)
+            {
+                while (true)
+                {
+                    long ret = syscall(SYS_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0);
+                    if (ret >= 0)
+                        return static_cast<int>(ret);
+                    if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+                        throw std::system_error(errno, std::generic_category(), "io_uring_enter");
+                }
+            }
+    };
+#endif
+
+    /* Waits out an in-flight batch if parsing throws, so the kernel never writes into freed buffers */
+    class DrainGuard
+    {
+        public:
+            explicit DrainGuard(ReadEngine& readEngine) : engine { readEngine }, armed { false } {}
+            ~DrainGuard()
+            {
+                if (!armed)
+                    return;
+                try
+                {
+                    engine.finish();
+                }
+                catch (...)
+                {
+                }
+            }
+
+            void arm() { armed = true; }
+            void disarm() { armed = false; }
+
+        private:
+            ReadEngine& engine;
+            bool armed;
+    };
+
+    inline bool is_space(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    /* Default line parser: one integer or floating-point number, surrounding blanks allowed */
+    template <typename T>
+    T parse_number(const char* begin, const char* end)
+    {
+        while (begin < end && is_space(*begin))
+            begin++;
+        while (end > begin && is_space(end[-1]))
+            end--;
+        T value {};
+        std::from_chars_result result = std::from_chars(begin, end, value);
+        if (result.ec != std::errc() || result.ptr != end)
+            throw std::runtime_error("Malformed number: '" + std::string(begin, end) + "'");
+        return value;
+    }
+
+    inline const char* after_newline(const char* pos, const char* end)
+    {
+        const void* hit = std::memchr(pos, '\n', static_cast<size_t>(end - pos));
+        return hit ? static_cast<const char*>(hit) + 1 : end;
+    }
+}
+
+class VectorLiteLoader
+{
+    public:
+        explicit VectorLiteLoader(const LoaderOptions& options = LoaderOptions{});
+
+        /* Appends parse(lineBegin, lineEnd) for every non-blank line; a trailing '\r' is stripped.
+           parse is called from several threads at once. */
+        template <typename T, typename Parse>
+        LoaderStats load_lines(VectorLite<T>& target, const std::string& path, Parse parse);
+
+        /* One integer or floating-point number per line */
+        template <typename T>
+        LoaderStats load_lines(VectorLite<T>& target, const std::string& path);
+
+        /* Appends the file as raw T records, read straight into the target's storage */
+        template <typename T>
+        LoaderStats load_binary(VectorLite<T>& target, const std::string& path);
+
+        LoaderBackend backend() const;
+
+    private:
+        static constexpr size_t min_chunk = 4096;
+        static constexpr size_t max_chunk = size_t{1} << 30; // io_uring read lengths are 32-bit
+
+        LoaderOptions opts;
+        unsigned workers;
+        LoaderBackend active;
+        std::unique_ptr<loader_detail::ReadEngine> engine;
+        std::unique_ptr<loader_detail::WorkerPool> parsers; // workers - 1 threads; the calling thread parses too
+
+        template <typename T>
+        static void reserve_for(VectorLite<T>& target, size_t extra);
+
+        template <typename T, typename Parse>
+        static void parse_segment(const char* begin, const char* end, Parse& parse, VectorLite<T>& out);
+};
+
+// ============================== Definitions ==============================
+
+inline VectorLiteLoader::VectorLiteLoader(const LoaderOptions& options):
+    opts { options },
+    workers { options.threads ? options.threads : std::thread::hardware_concurrency() },
+    active { LoaderBackend::Pread }
+{
+    if (workers == 0)
+        workers = 1;
+    if (opts.chunkBytes < min_chunk)
+        opts.chunkBytes = min_chunk;
+    if (opts.chunkBytes > max_chunk)
+        opts.chunkBytes = max_chunk;
+
+#if defined(VECTORLITE_HAVE_IO_URING)
+    if (opts.backend != LoaderBackend::Pread)
+    {
+        try
+        {
+            engine.reset(new loader_detail::UringEngine(workers));
+            active = LoaderBackend::IoUring;
+        }
+        catch (const std::system_error&)
+        {
+            if (opts.backend == LoaderBackend::IoUring)
+                throw; // seccomp, io_uring_disabled, or a pre-5.6 kernel
+        }
+    }
+#else
+    if (opts.backend == LoaderBackend::IoUring)
+        throw std::system_error(ENOSYS, std::generic_category(), "io_uring not available on this platform");
+#endif
+    if (!engine)
+        engine.reset(new loader_detail::PreadEngine(workers));
+    if (workers > 1)
+        parsers.reset(new loader_detail::WorkerPool(workers - 1));
+}
+
+inline LoaderBackend VectorLiteLoader::backend() const
+{
+    return active;
+}
+
+/* Grows geometrically so per-batch reservations stay amortized O(1) per element */
+template <typename T>
+void VectorLiteLoader::reserve_for(VectorLite<T>& target, size_t extra)
+{
+    const size_t needed = target.size() + extra;
+    if (needed <= target.capacity())
+        return;
+    target.reserve(needed > target.capacity() * 2 ? needed : target.capacity() * 2);
+}
+
+template <typename T, typename Parse>
+void VectorLiteLoader::parse_segment(const char* begin, const char* end, Parse& parse, VectorLite<T>& out)
+{
+    vector_detail::set_size_unchecked(out, 0); // keep the storage from the previous batch
+    while (begin < end)
+    {
+        const char* next = loader_detail::after_newline(begin, end);
+        const char* lineEnd = next;
+        if (lineEnd > begin && lineEnd[-1] == '\n')
+            lineEnd--;
+        if (lineEnd > begin && lineEnd[-1] == '\r')
+            lineEnd--;
+        if (lineEnd > begin)
+            out.push_back(parse(begin, lineEnd));
+        begin = next;
+    }
+}
+
+template <typename T>
+LoaderStats VectorLiteLoader::load_lines(VectorLite<T>& target, const std::string& path)
+{
+    static_assert(std::is_arithmetic<T>::value, "the default parser handles numbers; pass a parser for other types");
+    return load_lines(target, path, [](const char* begin, const char* end) {
+        return loader_detail::parse_number<T>(begin, end);
+    });
+}
+
+/*
+ * Each batch buffer is [carry room | chunkBytes * workers]. The unfinished
+ * last line of batch i is copied to the end of the carry room of batch
+ * i+1's buffer just before batch i+2's reads are issued into the buffer
+ * it came from, so a line may span any chunk or batch boundary.
+ */
+template <typename T, typename Parse>
+LoaderStats VectorLiteLoader::load_lines(VectorLite<T>& target, const std::string& path, Parse parse)
+{
+    loader_detail::FileHandle file(path);
+    const size_t fileBytes = file.size();
+    const size_t chunk = opts.chunkBytes;
+    const size_t carryRoom = chunk;
+    const size_t batchBytes = chunk * workers;
+    const size_t batchCount = (fileBytes + batchBytes - 1) / batchBytes;
+
+    LoaderStats stats;
+    stats.backend = active;
+    stats.bytes = fileBytes;
+    stats.batches = batchCount;
+    if (batchCount == 0)
+        return stats;
+
+    VectorLite<char> buffers[2] = { VectorLite<char>(carryRoom + batchBytes), VectorLite<char>(carryRoom + batchBytes) };
+    std::vector<loader_detail::ReadRequest> requests[2];
+    VectorLite<VectorLite<T>> parsed(workers);
+    for (unsigned w = 0; w < workers; w++)
+        parsed.push_back(VectorLite<T>());
+
+    auto issue = [&](size_t batch) {
+        std::vector<loader_detail::ReadRequest>& reqs = requests[batch % 2];
+        char* region = buffers[batch % 2].data() + carryRoom;
+        reqs.clear();
+        const size_t first = batch * batchBytes;
+        const size_t last = first + batchBytes < fileBytes ? first + batchBytes : fileBytes;
+        for (size_t offset = first; offset < last; offset += chunk)
+        {
+            const size_t len = offset + chunk < last ? chunk : last - offset;
+            reqs.push_back(loader_detail::ReadRequest{ region + (offset - first), len, offset, 0 });
+        }
+        engine->start(file.get(), reqs.data(), reqs.size());
+    };
+
+    loader_detail::DrainGuard drain(*engine);
+    drain.arm();
+    issue(0);
+    const char* carry = nullptr;
+    size_t carryLen = 0;
+
+    for (size_t batch = 0; batch < batchCount; batch++)
+    {
+        drain.disarm();
+        engine->finish();
+
+        char* region = buffers[batch % 2].data() + carryRoom;
+        const size_t regionLen = batch + 1 < batchCount ? batchBytes : fileBytes - batch * batchBytes;
+        char* begin = region - carryLen;
+        if (carryLen)
+            std::memmove(begin, carry, carryLen);
+
+        if (batch + 1 < batchCount)
+        {
+            drain.arm();
+            issue(batch + 1); // overlaps with the parse below
+        }
+
+        // The last line of a middle batch may be unfinished; it carries over
+        const char* end = region + regionLen;
+        if (batch + 1 < batchCount)
+        {
+            const char* cut = end;
+            while (cut > begin && cut[-1] != '\n')
+                cut--;
+            carry = cut;
+            carryLen = static_cast<size_t>(end - cut);
+            if (carryLen > carryRoom)
+                throw std::runtime_error("Line longer than LoaderOptions::chunkBytes");
+            end = cut;
+        }
+
+        // Split at line boundaries, one segment per worker
+        const size_t spanLen = static_cast<size_t>(end - begin);
+        std::vector<const char*> cuts(workers + 1);
+        cuts[0] = begin;
+        for (unsigned w = 1; w < workers; w++)
+        {
+            const char* aim = begin + spanLen * w / workers;
+            cuts[w] = aim < cuts[w - 1] ? cuts[w - 1] : loader_detail::after_newline(aim, end);
+        }
+        cuts[workers] = end;
+
+        loader_detail::JobGroup parses;
+        for (unsigned w = 1; w < workers; w++)
+        {
+            if (cuts[w] < cuts[w + 1])
+                parsers->submit(parses, [&, w] { parse_segment(cuts[w], cuts[w + 1], parse, parsed[w]); });
+            else
+                vector_detail::set_size_unchecked(parsed[w], 0);
+        }
+        parse_segment(cuts[0], cuts[1], parse, parsed[0]);
+        parses.wait();
+
+        size_t batchRecords = 0;
+        for (unsigned w = 0; w < workers; w++)
+            batchRecords += parsed[w].size();
+        reserve_for(target, batchRecords);
+        for (unsigned w = 0; w < workers; w++)
+        {
+            VectorLite<T>& part = parsed[w];
+            T* dest = target.data() + target.size();
+            for (size_t idx = 0; idx < part.size(); idx++)
+                dest[idx] = std::move(part[idx]);
+            vector_detail::set_size_unchecked(target, target.size() + part.size());
+        }
+        stats.records += batchRecords;
+    }
+    return stats;
+}
+
+template <typename T>
+LoaderStats VectorLiteLoader::load_binary(VectorLite<T>& target, const std::string& path)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "binary loading copies raw bytes into T");
+    loader_detail::FileHandle file(path);
+    const size_t fileBytes = file.size();
+    if (fileBytes % sizeof(T) != 0)
+        throw std::runtime_error("File size is not a multiple of the element size");
+    const size_t count = fileBytes / sizeof(T);
+
+    LoaderStats stats;
+    stats.backend = active;
+    stats.bytes = fileBytes;
+    stats.records = count;
+    if (count == 0)
+        return stats;
+
+    reserve_for(target, count);
+    char* dest = reinterpret_cast<char*>(target.data() + target.size());
+    const size_t batchBytes = opts.chunkBytes * workers;
+    std::vector<loader_detail::ReadRequest> reqs;
+    for (size_t first = 0; first < fileBytes; first += batchBytes)
+    {
+        reqs.clear();
+        const size_t last = first + batchBytes < fileBytes ? first + batchBytes : fileBytes;
+        for (size_t offset = first; offset < last; offset += opts.chunkBytes)
+        {
+            const size_t len = offset + opts.chunkBytes < last ? opts.chunkBytes : last - offset;
+            reqs.push_back(loader_detail::ReadRequest{ dest + offset, len, offset, 0 });
+        }
+        engine->start(file.get(), reqs.data(), reqs.size());
+        engine->finish();
+        stats.batches++;
+    }
+    vector_detail::set_size_unchecked(target, target.size() + count);
+    return stats;
+}
@@ -0,0 +1,467 @@
+#pragma once
+
+#include "Vector.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <typeinfo>
+#include <unordered_set>
+#include <utility>
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(__has_include)
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#define VECTORLITE_HAVE_CXXABI 1
+#endif
+#endif
+
+/*
+ * Opt-in memory accounting for VectorLite.
+ *
+ * Vectors join the process-wide registry with track(tag) and leave it when
+ * they are destroyed or untracked. A report groups them by element type and
+ * tag and shows live bytes (size), reserved bytes (capacity), and the slack
+ * in between, plus a histogram of capacities, which is where reserve sizing
+ * or shrink-to-fit would give memory back.
+ *
+ *     VectorLite<float> samples;
+ *     samples.track("ingest.samples");
+ *     ...
+ *     std::cout << VectorLiteRegistry::instance().to_json();
+ *     VectorLiteRegistry::instance().shrink_all_over(1 << 20); // on memory pressure, from the owning thread
+ *
+ * Byte counts cover the element buffers only (capacity * sizeof(T)), not heap
+ * memory owned by the elements themselves. A tracked vector stores its size
+ * and capacity into its entry (relaxed atomics) whenever they change, so
+ * report(), to_json() and signal dumps never read the vectors themselves and
+ * are safe while the owners keep running; a report is a snapshot, not a
+ * consistent cut across vectors. shrink_all_over() reallocates the vectors,
+ * so it alone must run on the owning thread or while the owners are stopped.
+ */
+struct VectorLiteUsage
+{
+    std::string type; // demangled, e.g. "VectorLite<int>"; empty in the total
+    std::string tag;
+    size_t vectors = 0;
+    size_t liveBytes = 0;     // size * sizeof(T)
+    size_t capacityBytes = 0; // capacity * sizeof(T)
+    size_t slackBytes = 0;    // capacityBytes - liveBytes
+};
+
+struct VectorLiteReport
+{
+    static constexpr size_t histogram_buckets = 65;
+
+    VectorLiteUsage total;
+    VectorLite<VectorLiteUsage> groups;   // one per (type, tag), most slack first
+    VectorLite<size_t> capacityHistogram; // [0]: no storage, [k]: capacity bytes in [2^(k-1), 2^k)
+
+    std::string to_json() const;
+};
+
+namespace registry_detail
+{
+    /* vec, size and capacity live in the hook, where the vector keeps them current */
+    struct Entry : VectorLiteTrackerHook
+    {
+        const char* typeName; // mangled, demangled once per report group
+        size_t elemSize;
+        std::string tag;
+        void (*shrink)(void* vec);
+    };
+
+    /* Read by the signal handler, so a plain sig_atomic_t rather than a member */
+    inline volatile std::sig_atomic_t signalPipe = -1;
+
+    inline void on_dump_signal(int)
+    {
+        const int savedErrno = errno;
+        const int fd = signalPipe;
+        if (fd >= 0)
+        {
+            const char wake = 1;
+            ssize_t ignored = ::write(fd, &wake, 1); // non-blocking: a full pipe already has a dump queued
+            (void)ignored;
+        }
+        errno = savedErrno;
+    }
+
+    inline std::string readable_type(const char* mangled)
+    {
+#if defined(VECTORLITE_HAVE_CXXABI)
+        int status = 0;
+        char* name = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+        if (status == 0 && name != nullptr)
+        {
+            std::string result(name);
+            std::free(name);
+            return result;
+        }
+#endif
+        return mangled;
+    }
+
+    inline size_t histogram_bucket(size_t bytes)
+    {
+        size_t bucket = 0;
+        while (bytes != 0)
+        {
+            bytes >>= 1;
+            bucket++;
+        }
+        return bucket;
+    }
+
+    inline void append_json_string(std::ostringstream& out, const std::string& text)
+    {
+        static const char hex[] = "0123456789abcdef";
+        out << '"';
+        for (char c : text)
+        {
+            const unsigned char u = static_cast<unsigned char>(c);
+            if (c == '"' || c == '\\')
+                out << '\\' << c;
+            else if (u < 0x20)
+                out << "\\u00" << hex[u >> 4] << hex[u & 0xf];
+            else
+                out << c;
+        }
+        out << '"';
+    }
+
+    inline void append_json_usage(std::ostringstream& out, const VectorLiteUsage& usage, bool named)
+    {
+        out << '{';
+        if (named)
+        {
+            out << "\"type\":";
+            append_json_string(out, usage.type);
+            out << ",\"tag\":";
+            append_json_string(out, usage.tag);
+            out << ',';
+        }
+        out << "\"vectors\":" << usage.vectors
+            << ",\"live_bytes\":" << usage.liveBytes
+            << ",\"capacity_bytes\":" << usage.capacityBytes
+            << ",\"slack_bytes\":" << usage.slackBytes << '}';
+    }
+}
+
+class VectorLiteRegistry
+{
+    public:
+        /* Never destroyed, so vectors with static storage can still untrack at exit */
+        static VectorLiteRegistry& instance();
+
+        VectorLiteRegistry(const VectorLiteRegistry&) = delete;
+        VectorLiteRegistry& operator=(const VectorLiteRegistry&) = delete;
+
+        size_t tracked_count() const;
+
+        /* Any thread, any time: reads the sizes the vectors published, never the vectors */
+        VectorLiteReport report() const;
+        std::string to_json() const;
+
+        /* Shrinks every tracked vector with more than slackBytes unused; returns the bytes released.
+           Owner-thread-only: it reallocates the vectors, so none may be in use on another thread,
+           and views and iterators into shrunk vectors are invalidated. */
+        size_t shrink_all_over(size_t slackBytes);
+
+        /* On signo, a watcher thread writes to_json() to path (stderr when empty). The handler
+           itself only writes a byte to a pipe, so it is async-signal-safe, and the dump is built
+           from published sizes like report(), so the signal may arrive while the owners run. */
+        void install_signal_dump(int signo = SIGUSR1, const std::string& path = "");
+        void remove_signal_dump();
+
+    private:
+        template <typename T>
+        friend class VectorLite;
+
+        mutable std::recursive_mutex mtx; // guards entries; recursive: shrinking can destroy tracked elements
+        std::unordered_set<registry_detail::Entry*> entries;
+
+        std::mutex signalMtx;
+        std::thread watcher;
+        std::atomic<bool> stopWatcher { false };
+        int pipeRead = -1;
+        int pipeWrite = -1;
+        int dumpSignal = 0;
+        struct sigaction previousAction {};
+
+        VectorLiteRegistry() = default;
+
+        template <typename T>
+        VectorLiteTrackerHook* attach(VectorLite<T>& vec, VectorLiteTrackerHook* current,
+                                      const std::string& tag);
+        static void detach(VectorLiteTrackerHook* hook);
+
+        void write_dump(const std::string& path) const;
+};
+
+// ============================== Definitions ==============================
+
+inline VectorLiteRegistry& VectorLiteRegistry::instance()
+{
+    static VectorLiteRegistry* registry = new VectorLiteRegistry();
+    return *registry;
+}
+
+template <typename T>
+void VectorLite<T>::track(const std::string& tag)
+{
+    tracker = VectorLiteRegistry::instance().attach(*this, tracker, tag);
+}
+
+/* Tracking again only changes the tag of the current entry */
+template <typename T>
+VectorLiteTrackerHook* VectorLiteRegistry::attach(VectorLite<T>& vec, VectorLiteTrackerHook* current,
+                                                  const std::string& tag)
+{
+    std::lock_guard<std::recursive_mutex> lock(mtx);
+    if (current != nullptr)
+    {
+        static_cast<registry_detail::Entry*>(current)->tag = tag;
+        return current;
+    }
+
+    auto* entry = new registry_detail::Entry();
+    entry->untrack = &VectorLiteRegistry::detach;
+    entry->vec.store(&vec, std::memory_order_relaxed);
+    entry->size.store(vec.size(), std::memory_order_relaxed);
+    entry->capacity.store(vec.capacity(), std::memory_order_relaxed);
+    entry->typeName = typeid(VectorLite<T>).name();
+    entry->elemSize = sizeof(T);
+    entry->tag = tag;
+    entry->shrink = [](void* v) { static_cast<VectorLite<T>*>(v)->shrink_to_fit(); };
+
+    entries.insert(entry);
+    return entry;
+}
+
+inline void VectorLiteRegistry::detach(VectorLiteTrackerHook* hook)
+{
+    auto* entry = static_cast<registry_detail::Entry*>(hook);
+    VectorLiteRegistry& registry = instance();
+    {
+        std::lock_guard<std::recursive_mutex> lock(registry.mtx);
+        registry.entries.erase(entry);
+    }
+    delete entry;
+}
+
+inline size_t VectorLiteRegistry::tracked_count() const
+{
+    std::lock_guard<std::recursive_mutex> lock(mtx);
+    return entries.size();
+}
+
+inline VectorLiteReport VectorLiteRegistry::report() const
+{
+    VectorLiteReport result;
+    for (size_t i = 0; i < VectorLiteReport::histogram_buckets; i++)
+    {
+        result.capacityHistogram.push_back(0);
+    }
+
+    std::map<std::pair<const char*, std::string>, VectorLiteUsage> byGroup;
+    {
+        std::lock_guard<std::recursive_mutex> lock(mtx);
+        for (const registry_detail::Entry* entry : entries)
+        {
+            // the two fields are stored separately; mid-growth, size may already be past the old capacity
+            const size_t count = entry->size.load(std::memory_order_relaxed);
+            const size_t slots = entry->capacity.load(std::memory_order_relaxed);
+            const size_t live = count * entry->elemSize;
+            const size_t reserved = (slots > count ? slots : count) * entry->elemSize;
+
+            VectorLiteUsage& group = byGroup[{ entry->typeName, entry->tag }];
+            group.vectors++;
+            group.liveBytes += live;
+            group.capacityBytes += reserved;
+            group.slackBytes += reserved - live;
+
+            result.capacityHistogram[registry_detail::histogram_bucket(reserved)]++;
+        }
+    }
+
+    result.groups.reserve(byGroup.size());
+    for (auto& [key, usage] : byGroup)
+    {
+        usage.type = registry_detail::readable_type(key.first);
+        usage.tag = key.second;
+        result.total.vectors += usage.vectors;
+        result.total.liveBytes += usage.liveBytes;
+        result.total.capacityBytes += usage.capacityBytes;
+        result.total.slackBytes += usage.slackBytes;
+        result.groups.push_back(std::move(usage));
+    }
+    std::stable_sort(result.groups.data(), result.groups.data() + result.groups.size(),
+                     [](const VectorLiteUsage& a, const VectorLiteUsage& b) { return a.slackBytes > b.slackBytes; });
+    return result;
+}
+
+inline std::string VectorLiteReport::to_json() const
+{
+    std::ostringstream out;
+    out << "{\"total\":";
+    registry_detail::append_json_usage(out, total, false);
+
+    out << ",\"groups\":[";
+    for (size_t i = 0; i < groups.size(); i++)
+    {
+        if (i != 0)
+            out << ',';
+        registry_detail::append_json_usage(out, groups[i], true);
+    }
+
+    out << "],\"capacity_histogram\":[";
+    bool first = true;
+    for (size_t bucket = 0; bucket < capacityHistogram.size(); bucket++)
+    {
+        if (capacityHistogram[bucket] == 0)
+            continue;
+        if (!first)
+            out << ',';
+        first = false;
+        const size_t minBytes = bucket == 0 ? 0 : size_t{1} << (bucket - 1);
+        out << "{\"min_bytes\":" << minBytes << ",\"max_bytes\":";
+        if (bucket == 0)
+            out << 0;
+        else
+            out << minBytes + (minBytes - 1); // inclusive, and never overflows for the top bucket
+        out << ",\"vectors\":" << capacityHistogram[bucket] << '}';
+    }
+    out << "]}";
+    return out.str();
+}
+
+inline std::string VectorLiteRegistry::to_json() const
+{
+    return report().to_json();
+}
+
+/* Works from a snapshot: shrinking may destroy tracked elements, which erase their own entries */
+inline size_t VectorLiteRegistry::shrink_all_over(size_t slackBytes)
+{
+    std::lock_guard<std::recursive_mutex> lock(mtx);
+    VectorLite<registry_detail::Entry*> snapshot(entries.size());
+    for (registry_detail::Entry* entry : entries)
+    {
+        snapshot.push_back(entry);
+    }
+
+    size_t released = 0;
+    for (registry_detail::Entry* entry : snapshot)
+    {
+        if (entries.count(entry) == 0)
+            continue;
+        const size_t before = entry->capacity.load(std::memory_order_relaxed);
+        if ((before - entry->size.load(std::memory_order_relaxed)) * entry->elemSize <= slackBytes)
+            continue;
+        entry->shrink(entry->vec.load(std::memory_order_relaxed));
+        released += (before - entry->capacity.load(std::memory_order_relaxed)) * entry->elemSize;
+    }
+    return released;
+}
+
+inline void VectorLiteRegistry::write_dump(const std::string& path) const
+{
+    const std::string json = to_json();
+    if (path.empty())
+    {
+        std::cerr << json << std::endl;
+        return;
+    }
+    // write then rename, so readers never see a half-written report
+    const std::string partial = path + ".partial";
+    {
+        std::ofstream out(partial, std::ios::trunc);
+        out << json << '\n';
+        if (!out)
+            return;
+    }
+    std::rename(partial.c_str(), path.c_str());
+}
+
+inline void VectorLiteRegistry::install_signal_dump(int signo, const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(signalMtx);
+    if (watcher.joinable())
+        throw std::logic_error("A signal dump is already installed");
+
+    int fds[2];
+    if (::pipe(fds) != 0)
+        throw std::system_error(errno, std::generic_category(), "pipe");
+    ::fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+    ::fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+    ::fcntl(fds[1], F_SETFL, O_NONBLOCK);
+
+    struct sigaction action {};
+    action.sa_handler = &registry_detail::on_dump_signal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+
+    pipeRead = fds[0];
+    pipeWrite = fds[1];
+    registry_detail::signalPipe = pipeWrite;
+    if (::sigaction(signo, &action, &previousAction) != 0)
+    {
+        const int error = errno;
+        registry_detail::signalPipe = -1;
+        ::close(pipeRead);
+        ::close(pipeWrite);
+        pipeRead = pipeWrite = -1;
+        throw std::system_error(error, std::generic_category(), "sigaction");
+    }
+    dumpSignal = signo;
+    stopWatcher = false;
+
+    const int readFd = pipeRead;
+    watcher = std::thread([this, readFd, path] {
+        char wakes[64];
+        while (true)
+        {
+            const ssize_t n = ::read(readFd, wakes, sizeof(wakes)); // coalesces signals that arrive together
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0 || stopWatcher)
+                return;
+            write_dump(path);
+        }
+    });
+}
+
+inline void VectorLiteRegistry::remove_signal_dump()
+{
+    std::lock_guard<std::mutex> lock(signalMtx);
+    if (!watcher.joinable())
+        return;
+
+    ::sigaction(dumpSignal, &previousAction, nullptr);
+    registry_detail::signalPipe = -1;
+
+    stopWatcher = true;
+    const char wake = 1;
+    ssize_t ignored = ::write(pipeWrite, &wake, 1);
+    (void)ignored;
+    watcher.join();
+
+    ::close(pipeRead);
+    ::close(pipeWrite);
+    pipeRead = pipeWrite = -1;
+}
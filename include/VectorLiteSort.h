@@ -0,0 +1,342 @@
+#pragma once
+
+#include "Vector.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * LSD radix sort for VectorLites of integers and floats, and for any
+ * element type sorted by an integer or floating-point key.
+ *
+ *  - Every variant is stable, so radix_sort_by_key on (key, payload) pairs
+ *    keeps equal keys in their original order.
+ *  - Signed integers sort in numeric order. Floats sort as -NaN < -inf <
+ *    ... < -0.0 < +0.0 < ... < +inf < +NaN.
+ *  - Digits are 8, 11 or 16 bits (RadixDigits::Auto picks from key width
+ *    and length). A pass whose digit is the same for every element is
+ *    skipped.
+ *  - Elements ping-pong between the vector and one scratch VectorLite of
+ *    size() elements with the same allocation options, freed on return.
+ *    The vector's buffer and capacity are left as they were, so adopted
+ *    buffers keep their owner and no dead capacity is left behind.
+ */
+enum class RadixDigits
+{
+    Auto = 0,
+    Bits8 = 8,
+    Bits11 = 11,
+    Bits16 = 16
+};
+
+namespace radix_detail
+{
+    /* Maps a key to an unsigned integer whose natural order is the key's order */
+    template <typename K, typename Enable = void>
+    struct KeyTraits;
+
+    template <typename K>
+    struct KeyTraits<K, std::enable_if_t<std::is_integral<K>::value && !std::is_same<K, bool>::value>>
+    {
+        using bits_type = std::make_unsigned_t<K>;
+
+        static bits_type encode(K key)
+        {
+            constexpr bits_type sign = std::is_signed<K>::value ? bits_type(bits_type(1) << (sizeof(K) * 8 - 1)) : 0;
+            return static_cast<bits_type>(static_cast<bits_type>(key) ^ sign);
+        }
+    };
+
+    template <typename K>
+    struct KeyTraits<K, std::enable_if_t<std::is_floating_point<K>::value>>
+    {
+        static_assert(sizeof(K) == 4 || sizeof(K) == 8, "radix sort supports float and double keys");
+        using bits_type = std::conditional_t<sizeof(K) == 4, uint32_t, uint64_t>;
+
+        /* Negative values: flip every bit (reverses their order); positive: flip the sign bit */
+        static bits_type encode(K key)
+        {
+            bits_type bits;
+            std::memcpy(&bits, &key, sizeof(bits));
+            constexpr unsigned top = sizeof(bits_type) * 8 - 1;
+            const bits_type mask = static_cast<bits_type>(-(bits >> top)) | (bits_type(1) << top);
+            return bits ^ mask;
+        }
+    };
+
+    template <typename T, typename KeyFn>
+    using key_t = std::decay_t<decltype(std::declval<KeyFn&>()(std::declval<const T&>()))>;
+
+    template <typename T, typename KeyFn>
+    using bits_t = typename KeyTraits<key_t<T, KeyFn>>::bits_type;
+
+    struct Identity
+    {
+        template <typename T>
+        T operator()(const T& value) const { return value; }
+    };
+
+    template <typename U>
+    unsigned auto_bits(size_t n)
+    {
+        if (sizeof(U) == 1)
+            return 8;
+        if (sizeof(U) == 2)
+            return n >= (size_t{1} << 17) ? 16 : 8;
+        return n >= (size_t{1} << 16) ? 11 : 8;
+    }
+
+    template <unsigned Bits, typename U>
+    size_t digit(U bits, unsigned pass)
+    {
+        return static_cast<size_t>((bits >> (pass * Bits)) & ((size_t{1} << Bits) - 1));
+    }
+
+    inline VectorLite<size_t> zeroed(size_t count)
+    {
+        VectorLite<size_t> counts(count);
+        for (size_t idx = 0; idx < count; idx++)
+            counts.push_back(0);
+        return counts;
+    }
+
+    template <unsigned Bits, typename T, typename KeyFn>
+    void lsd_sort(VectorLite<T>& vec, KeyFn key)
+    {
+        using U = bits_t<T, KeyFn>;
+        using Traits = KeyTraits<key_t<T, KeyFn>>;
+        constexpr unsigned passes = (sizeof(U) * 8 + Bits - 1) / Bits;
+        constexpr size_t buckets = size_t{1} << Bits;
+
+        const size_t n = vec.size();
+        if (n < 2)
+            return;
+        VectorLite<T> scratch(n, vec.alloc_options());
+        T* const data = vec.data();
+
+        // One read builds the histograms of every pass
+        VectorLite<size_t> counts = zeroed(passes * buckets);
+        size_t* const hist = counts.data();
+        for (size_t idx = 0; idx < n; idx++)
+        {
+            const U bits = Traits::encode(key(data[idx]));
+            for (unsigned pass = 0; pass < passes; pass++)
+                hist[pass * buckets + digit<Bits>(bits, pass)]++;
+        }
+
+        T* from = data;
+        T* to = scratch.data();
+        for (unsigned pass = 0; pass < passes; pass++)
+        {
+            size_t* offsets = hist + pass * buckets;
+            bool trivial = false;
+            size_t sum = 0;
+            for (size_t d = 0; d < buckets; d++)
+            {
+                const size_t count = offsets[d];
+                trivial = trivial || count == n;
+                offsets[d] = sum;
+                sum += count;
+            }
+            if (trivial)
+                continue;
+            for (size_t idx = 0; idx < n; idx++)
+            {
+                const size_t d = digit<Bits>(Traits::encode(key(from[idx])), pass);
+                to[offsets[d]++] = std::move(from[idx]);
+            }
+            std::swap(from, to);
+        }
+        if (from != data)
+        {
+            for (size_t idx = 0; idx < n; idx++)
+                data[idx] = std::move(from[idx]);
+        }
+    }
+
+    /* Reusable rendezvous for the worker threads between histogram and scatter phases */
+    class Barrier
+    {
+        public:
+            explicit Barrier(unsigned parties) : count { parties }, waiting { 0 }, generation { 0 } {}
+
+            void wait()
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                const unsigned arrivedIn = generation;
+                if (++waiting == count)
+                {
+                    waiting = 0;
+                    generation++;
+                    cv.notify_all();
+                    return;
+                }
+                cv.wait(lock, [&] { return generation != arrivedIn; });
+            }
+
+        private:
+            std::mutex mutex;
+            std::condition_variable cv;
+            unsigned count;
+            unsigned waiting;
+            unsigned generation;
+    };
+
+    constexpr size_t min_parallel_elements = size_t{1} << 16;
+
+    /*
+     * Each thread owns a contiguous chunk. Per pass it histograms its chunk,
+     * then (after a barrier) derives its own scatter offsets: elements of
+     * digit d from thread t land after all smaller digits and after digit d
+     * from threads < t, which keeps the sort stable.
+     */
+    template <unsigned Bits, typename T, typename KeyFn>
+    void parallel_lsd_sort(VectorLite<T>& vec, KeyFn key, unsigned threads)
+    {
+        using U = bits_t<T, KeyFn>;
+        using Traits = KeyTraits<key_t<T, KeyFn>>;
+        constexpr unsigned passes = (sizeof(U) * 8 + Bits - 1) / Bits;
+        constexpr size_t buckets = size_t{1} << Bits;
+
+        const size_t n = vec.size();
+        if (threads > n / min_parallel_elements)
+            threads = static_cast<unsigned>(n / min_parallel_elements);
+        if (threads <= 1)
+        {
+            lsd_sort<Bits>(vec, key);
+            return;
+        }
+        VectorLite<T> scratch(n, vec.alloc_options());
+        T* const data = vec.data();
+        T* const spare = scratch.data();
+
+        VectorLite<size_t> counts = zeroed(threads * buckets);
+        size_t* const hist = counts.data();
+        Barrier barrier(threads);
+
+        auto worker = [&, threads](unsigned t) {
+            const size_t begin = n * t / threads;
+            const size_t end = n * (t + 1) / threads;
+            size_t* const mine = hist + t * buckets;
+            VectorLite<size_t> offsetStore = zeroed(buckets);
+            size_t* const offsets = offsetStore.data();
+            T* from = data;
+            T* to = spare;
+
+            for (unsigned pass = 0; pass < passes; pass++)
+            {
+                for (size_t d = 0; d < buckets; d++)
+                    mine[d] = 0;
+                for (size_t idx = begin; idx < end; idx++)
+                    mine[digit<Bits>(Traits::encode(key(from[idx])), pass)]++;
+                barrier.wait();
+
+                bool trivial = false;
+                size_t base = 0;
+                for (size_t d = 0; d < buckets; d++)
+                {
+                    size_t total = 0;
+                    size_t before = 0;
+                    for (unsigned other = 0; other < threads; other++)
+                    {
+                        if (other == t)
+                            before = total;
+                        total += hist[other * buckets + d];
+                    }
+                    trivial = trivial || total == n;
+                    offsets[d] = base + before;
+                    base += total;
+                }
+                if (!trivial)
+                {
+                    for (size_t idx = begin; idx < end; idx++)
+                    {
+                        const size_t d = digit<Bits>(Traits::encode(key(from[idx])), pass);
+                        to[offsets[d]++] = std::move(from[idx]);
+                    }
+                }
+                barrier.wait(); // scatters finished and histograms read before they are reset
+                if (!trivial)
+                    std::swap(from, to);
+            }
+            if (from != data)
+            {
+                for (size_t idx = begin; idx < end; idx++)
+                    data[idx] = std::move(from[idx]);
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (unsigned t = 1; t < threads; t++)
+            pool.emplace_back(worker, t);
+        worker(0);
+        for (std::thread& th : pool)
+            th.join();
+    }
+
+    template <typename T, typename KeyFn>
+    void dispatch(VectorLite<T>& vec, KeyFn key, RadixDigits digits, unsigned threads)
+    {
+        unsigned bits = static_cast<unsigned>(digits);
+        if (digits == RadixDigits::Auto)
+            bits = auto_bits<bits_t<T, KeyFn>>(vec.size());
+        if (threads == 0)
+            threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+        switch (bits)
+        {
+            case 8:
+                if (threads > 1)
+                    parallel_lsd_sort<8>(vec, key, threads);
+                else
+                    lsd_sort<8>(vec, key);
+                break;
+            case 11:
+                if (threads > 1)
+                    parallel_lsd_sort<11>(vec, key, threads);
+                else
+                    lsd_sort<11>(vec, key);
+                break;
+            default:
+                if (threads > 1)
+                    parallel_lsd_sort<16>(vec, key, threads);
+                else
+                    lsd_sort<16>(vec, key);
+                break;
+        }
+    }
+}
+
+/* Ascending, stable sort of integers or floats */
+template <typename T>
+void radix_sort(VectorLite<T>& vec, RadixDigits digits = RadixDigits::Auto)
+{
+    radix_detail::dispatch(vec, radix_detail::Identity{}, digits, 1);
+}
+
+/* Stable sort by key(element), e.g. radix_sort_by_key(pairs, [](const auto& p) { return p.first; }) */
+template <typename T, typename KeyFn>
+void radix_sort_by_key(VectorLite<T>& vec, KeyFn key, RadixDigits digits = RadixDigits::Auto)
+{
+    radix_detail::dispatch(vec, key, digits, 1);
+}
+
+/* Multi-threaded radix_sort; threads == 0 uses one per hardware thread. Same result as radix_sort. */
+template <typename T>
+void parallel_radix_sort(VectorLite<T>& vec, unsigned threads = 0, RadixDigits digits = RadixDigits::Auto)
+{
+    radix_detail::dispatch(vec, radix_detail::Identity{}, digits, threads);
+}
+
+template <typename T, typename KeyFn>
+void parallel_radix_sort_by_key(VectorLite<T>& vec, KeyFn key, unsigned threads = 0,
+                                RadixDigits digits = RadixDigits::Auto)
+{
+    radix_detail::dispatch(vec, key, digits, threads);
+}
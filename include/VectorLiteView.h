@@ -0,0 +1,229 @@
+#pragma once
+
+#include "Vector.h"
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+/*
+ * Non-owning window onto VectorLite storage: a pointer, a length and a
+ * stride in elements. Slicing and striding only adjust those three
+ * numbers, nothing is ever copied. A view is invalidated by anything that
+ * reallocates the underlying vector (push_back past capacity, reserve,
+ * clear, release). Use VectorLiteView<const T> for read-only windows.
+ */
+template <typename T>
+class VectorLiteView
+{
+    public:
+        using value_type = std::remove_const_t<T>;
+
+        VectorLiteView();
+        VectorLiteView(T* ptr, size_t count, size_t stride = 1);
+        VectorLiteView(VectorLite<value_type>& vec);
+
+        template <typename U = T, typename = std::enable_if_t<std::is_const<U>::value>>
+        VectorLiteView(const VectorLite<value_type>& vec);
+
+        /* A view of T converts to a view of const T */
+        template <typename U = T, typename = std::enable_if_t<std::is_const<U>::value>>
+        VectorLiteView(const VectorLiteView<value_type>& other);
+
+        VectorLiteView<T> subview(size_t offset, size_t count) const; // throws std::out_of_range past the end
+        VectorLiteView<T> first(size_t count) const;
+        VectorLiteView<T> last(size_t count) const;
+        VectorLiteView<T> strided(size_t step) const; // every step-th element, starting with the first
+
+        T& at(size_t index) const; // throws std::out_of_range if out of bounds
+        T& operator[](size_t index) const;
+
+        T& front() const;
+        T& back() const;
+
+        size_t size() const;
+        size_t stride() const;
+        bool empty() const;
+        bool contiguous() const; // true when data()..data()+size() is exactly the view
+        T* data() const;
+
+        VectorLite<value_type> to_vector() const; // the one operation that copies
+
+        /* Walks by index rather than pointer, so end() of a strided view never forms a pointer past the buffer */
+        class iterator {
+            private:
+                T* base;
+                size_t idx;
+                size_t step;
+            public:
+                using value_type = std::remove_const_t<T>;
+                using difference_type = std::ptrdiff_t;
+                using pointer = T*;
+                using reference = T&;
+                using iterator_category = std::forward_iterator_tag;
+                iterator(T* b, size_t i, size_t s) : base(b), idx(i), step(s) {}
+
+                T& operator*() const { return base[idx * step]; }
+
+                iterator& operator++() { idx++; return *this; }
+                iterator& operator--() { idx--; return *this; }
+                iterator operator++(int) { iterator old(base, idx, step); idx++; return old; }
+                iterator operator--(int) { iterator old(base, idx, step); idx--; return old; }
+
+                bool operator==(const iterator& other) const { return base == other.base && idx == other.idx; }
+                bool operator!=(const iterator& other) const { return !(*this == other); }
+        };
+
+    iterator begin() const;
+    iterator end() const;
+
+    private:
+        T* ptr;
+        size_t len;
+        size_t step;
+};
+
+// ============================== Definitions ==============================
+
+template <typename T>
+VectorLiteView<T>::VectorLiteView():
+    ptr { nullptr },
+    len { 0 },
+    step { 1 }
+{ }
+
+template <typename T>
+VectorLiteView<T>::VectorLiteView(T* p, size_t count, size_t stride):
+    ptr { p },
+    len { count },
+    step { stride ? stride : 1 }
+{ }
+
+template <typename T>
+VectorLiteView<T>::VectorLiteView(VectorLite<value_type>& vec):
+    ptr { vec.data() },
+    len { vec.size() },
+    step { 1 }
+{ }
+
+template <typename T>
+template <typename U, typename>
+VectorLiteView<T>::VectorLiteView(const VectorLite<value_type>& vec):
+    ptr { vec.data() },
+    len { vec.size() },
+    step { 1 }
+{ }
+
+template <typename T>
+template <typename U, typename>
+VectorLiteView<T>::VectorLiteView(const VectorLiteView<value_type>& other):
+    ptr { other.data() },
+    len { other.size() },
+    step { other.stride() }
+{ }
+
+template <typename T>
+VectorLiteView<T> VectorLiteView<T>::subview(size_t offset, size_t count) const
+{
+    if (offset > len || count > len - offset)
+        throw std::out_of_range("Subview out of bounds");
+    if (offset == len) // empty tail: one past the last element, not a whole stride past it
+        return VectorLiteView<T>(len ? ptr + (len - 1) * step + 1 : ptr, 0, step);
+    return VectorLiteView<T>(ptr + offset * step, count, step);
+}
+
+template <typename T>
+VectorLiteView<T> VectorLiteView<T>::first(size_t count) const
+{
+    return subview(0, count);
+}
+
+template <typename T>
+VectorLiteView<T> VectorLiteView<T>::last(size_t count) const
+{
+    if (count > len)
+        throw std::out_of_range("Subview out of bounds");
+    return subview(len - count, count);
+}
+
+template <typename T>
+VectorLiteView<T> VectorLiteView<T>::strided(size_t every) const
+{
+    if (every == 0)
+        throw std::invalid_argument("Stride must be positive");
+    return VectorLiteView<T>(ptr, (len + every - 1) / every, step * every);
+}
+
+template <typename T>
+T& VectorLiteView<T>::at(size_t index) const
+{
+    if (index >= len)
+        throw std::out_of_range("Index out of bounds");
+    return ptr[index * step];
+}
+
+template <typename T>
+T& VectorLiteView<T>::operator[](size_t index) const
+{
+    return ptr[index * step];
+}
+
+template <typename T>
+T& VectorLiteView<T>::front() const
+{
+    return at(0);
+}
+
+template <typename T>
+T& VectorLiteView<T>::back() const
+{
+    if (len == 0)
+        throw std::out_of_range("Index out of bounds");
+    return ptr[(len - 1) * step];
+}
+
+template <typename T>
+size_t VectorLiteView<T>::size() const
+{
+    return len;
+}
+
+template <typename T>
+size_t VectorLiteView<T>::stride() const
+{
+    return step;
+}
+
+template <typename T>
+bool VectorLiteView<T>::empty() const
+{
+    return len == 0;
+}
+
+template <typename T>
+bool VectorLiteView<T>::contiguous() const
+{
+    return step == 1 || len <= 1;
+}
+
+template <typename T>
+T* VectorLiteView<T>::data() const
+{
+    return ptr;
+}
+
+template <typename T>
+VectorLite<typename VectorLiteView<T>::value_type> VectorLiteView<T>::to_vector() const
+{
+    VectorLite<value_type> copy(len);
+    for (size_t idx = 0; idx < len; idx++)
+    {
+        copy.push_back(ptr[idx * step]);
+    }
+    return copy;
+}
+
+template <typename T>
+typename VectorLiteView<T>::iterator VectorLiteView<T>::begin() const { return iterator(ptr, 0, step); }
+
+template <typename T>
+typename VectorLiteView<T>::iterator VectorLiteView<T>::end() const { return iterator(ptr, len, step); }
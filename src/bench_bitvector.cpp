@@ -0,0 +1,105 @@
+#include "../include/BitVectorLite.h"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+struct Timer
+{
+    std::chrono::high_resolution_clock::time_point start;
+    Timer() { start = std::chrono::high_resolution_clock::now(); }
+    double elapsed_ms() const {
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+};
+
+class BitmapBenchmarks
+{
+private:
+    static constexpr size_t N = 64'000'000;
+    static constexpr int trials = 5;
+
+    /* Filter pattern: combine two bitmaps, then count the survivors */
+    template <typename BoolVecT>
+    double run_bytes(BoolVecT& a, const BoolVecT& b, size_t& survivors)
+    {
+        Timer t;
+        for (size_t i = 0; i < N; i++) {
+            a[i] = a[i] && b[i];
+        }
+        for (size_t i = 0; i < N; i++) {
+            survivors += a[i] ? 1 : 0;
+        }
+        return t.elapsed_ms();
+    }
+
+    double run_packed(BitVectorLite& a, const BitVectorLite& b, size_t& survivors)
+    {
+        Timer t;
+        a &= b;
+        survivors += a.count();
+        return t.elapsed_ms();
+    }
+
+    static bool pattern_a(size_t i) { return (i * 2654435761u) % 3 != 0; }
+    static bool pattern_b(size_t i) { return (i * 40503u) % 5 != 0; }
+
+public:
+    void runTests()
+    {
+        {
+            double total = 0;
+            size_t survivors = 0;
+            for (int trial = 0; trial < trials; trial++) {
+                VectorLite<bool> a(N), b(N);
+                for (size_t i = 0; i < N; i++) {
+                    a.push_back(pattern_a(i));
+                    b.push_back(pattern_b(i));
+                }
+                total += run_bytes(a, b, survivors);
+            }
+            std::cout << "VectorLite<bool> (1 byte/flag, " << N / (1 << 20) << " MiB) avg over "
+                      << trials << " trials: " << (total / trials) << " ms (survivors " << survivors << ")\n";
+        }
+
+        {
+            double total = 0;
+            size_t survivors = 0;
+            for (int trial = 0; trial < trials; trial++) {
+                std::vector<bool> a(N), b(N);
+                for (size_t i = 0; i < N; i++) {
+                    a[i] = pattern_a(i);
+                    b[i] = pattern_b(i);
+                }
+                total += run_bytes(a, b, survivors);
+            }
+            std::cout << "std::vector<bool> avg over " << trials << " trials: "
+                      << (total / trials) << " ms (survivors " << survivors << ")\n";
+        }
+
+        {
+            double total = 0;
+            size_t survivors = 0;
+            for (int trial = 0; trial < trials; trial++) {
+                BitVectorLite a(N, false), b(N, false);
+                for (size_t i = 0; i < N; i++) {
+                    a[i] = pattern_a(i);
+                    b[i] = pattern_b(i);
+                }
+                total += run_packed(a, b, survivors);
+            }
+            std::cout << "BitVectorLite (" << N / 8 / (1 << 20) << " MiB) avg over " << trials
+                      << " trials: " << (total / trials) << " ms (survivors " << survivors << ")\n";
+        }
+    }
+};
+
+int main()
+{
+    std::cout << "=====Executing Bitmap Benchmark in C++=====\n";
+    std::cout << "AND of two 64,000,000-entry bitmaps followed by a count\n";
+
+    BitmapBenchmarks Tests;
+    Tests.runTests();
+}
@@ -0,0 +1,134 @@
+#include "../include/CompressedVectorLite.h"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+
+struct Timer
+{
+    std::chrono::high_resolution_clock::time_point start;
+    Timer() { start = std::chrono::high_resolution_clock::now(); }
+    double elapsed_ms() const {
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+};
+
+class CompressionBenchmarks
+{
+private:
+    static constexpr size_t N = 32'000'000;
+    static constexpr int trials = 5;
+    static constexpr size_t lookups = 4'000'000;
+
+    template <typename Int>
+    static double scan_raw(const VectorLite<Int>& v, uint64_t& checksum)
+    {
+        Timer t;
+        for (size_t i = 0; i < v.size(); i++) {
+            checksum += v[i];
+        }
+        return t.elapsed_ms();
+    }
+
+    template <typename Int>
+    static double scan_blocks(const CompressedVectorLite<Int>& cv, uint64_t& checksum)
+    {
+        Int buffer[CompressedVectorLite<Int>::block_size];
+        Timer t;
+        for (size_t block = 0; block < cv.block_count(); block++) {
+            size_t n = cv.decode_block(block, buffer);
+            for (size_t i = 0; i < n; i++) {
+                checksum += buffer[i];
+            }
+        }
+        return t.elapsed_ms();
+    }
+
+    template <typename Int>
+    static double scan_iterator(const CompressedVectorLite<Int>& cv, uint64_t& checksum)
+    {
+        Timer t;
+        for (Int value : cv) {
+            checksum += value;
+        }
+        return t.elapsed_ms();
+    }
+
+    /* Same random positions for both, so the gap is the per-lookup decode cost */
+    template <typename Vec>
+    static double random_access(const Vec& v, const VectorLite<size_t>& positions, uint64_t& checksum)
+    {
+        Timer t;
+        for (size_t pos : positions) {
+            checksum += v[pos];
+        }
+        return t.elapsed_ms();
+    }
+
+    template <typename Int>
+    void report(const char* name, const VectorLite<Int>& column)
+    {
+        Timer build;
+        CompressedVectorLite<Int> cv(column);
+        double buildMs = build.elapsed_ms();
+
+        std::mt19937_64 rng(2);
+        VectorLite<size_t> positions(lookups);
+        for (size_t i = 0; i < lookups; i++) {
+            positions.push_back(rng() % column.size());
+        }
+
+        uint64_t checksum = 0;
+        double raw = 0, blocks = 0, iter = 0, rawRandom = 0, cvRandom = 0;
+        for (int i = 0; i < trials; i++) {
+            raw += scan_raw(column, checksum);
+            blocks += scan_blocks(cv, checksum);
+            iter += scan_iterator(cv, checksum);
+            rawRandom += random_access(column, positions, checksum);
+            cvRandom += random_access(cv, positions, checksum);
+        }
+        double gb = static_cast<double>(column.size() * sizeof(Int)) / 1e9;
+        std::cout << "--- " << name << " ---\n"
+                  << "  raw " << column.size() * sizeof(Int) / (1 << 20) << " MiB, compressed "
+                  << cv.memory_bytes() / (1 << 20) << " MiB (ratio "
+                  << static_cast<double>(cv.raw_bytes()) / cv.memory_bytes() << "x), encode " << buildMs << " ms\n"
+                  << "  VectorLite scan:       " << raw / trials << " ms (" << gb / (raw / trials / 1000) << " GB/s)\n"
+                  << "  decode_block scan:     " << blocks / trials << " ms (" << gb / (blocks / trials / 1000) << " GB/s)\n"
+                  << "  iterator scan:         " << iter / trials << " ms (" << gb / (iter / trials / 1000) << " GB/s)\n"
+                  << "  " << lookups << " random reads: VectorLite " << rawRandom / trials << " ms, compressed "
+                  << cvRandom / trials << " ms\n"
+                  << "  (checksum " << checksum << ")\n";
+    }
+
+public:
+    void runTests()
+    {
+        std::mt19937_64 rng(1);
+
+        VectorLite<uint32_t> ids(N);
+        uint32_t id = 0;
+        for (size_t i = 0; i < N; i++) {
+            id += 1 + static_cast<uint32_t>(rng() % 8);
+            ids.push_back(id);
+        }
+        report("sorted uint32 IDs, gaps 1-8", ids);
+
+        VectorLite<uint64_t> timestamps(N);
+        uint64_t ts = 1'700'000'000'000'000ULL;
+        for (size_t i = 0; i < N; i++) {
+            ts += 900 + rng() % 200;
+            timestamps.push_back(ts);
+        }
+        report("uint64 microsecond timestamps, ~1 ms apart", timestamps);
+    }
+};
+
+int main()
+{
+    std::cout << "=====Executing Compression Benchmark in C++=====\n";
+    std::cout << "Scanning 32,000,000-entry integer columns\n";
+
+    CompressionBenchmarks Tests;
+    Tests.runTests();
+}
@@ -0,0 +1,96 @@
+#include "../include/DequeLite.h"
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+
+struct Timer
+{
+    std::chrono::high_resolution_clock::time_point start;
+    Timer() { start = std::chrono::high_resolution_clock::now(); }
+    double elapsed_ms() const {
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+};
+
+class QueueBenchmarks
+{
+private:
+    static constexpr size_t N = 10'000'000;
+    static constexpr size_t depth = 1024; // steady-state queue length
+    static constexpr int trials = 5;
+
+    /* Work-queue pattern: keep `depth` items in flight, push one, pop one */
+    template <typename QueueT>
+    double run_fifo(QueueT& q, uint64_t& checksum)
+    {
+        q.clear();
+        Timer t;
+        for (size_t i = 0; i < depth; i++) {
+            q.push_back(i);
+        }
+        for (size_t i = depth; i < N; i++) {
+            checksum += q.front();
+            q.pop_front();
+            q.push_back(i);
+        }
+        while (!q.empty()) {
+            checksum += q.front();
+            q.pop_front();
+        }
+        return t.elapsed_ms();
+    }
+
+    /* Random access into a full queue, the case std::deque pays for with its block map */
+    template <typename QueueT>
+    double run_indexed(QueueT& q, uint64_t& checksum)
+    {
+        q.clear();
+        for (size_t i = 0; i < depth; i++) {
+            q.push_front(i);
+        }
+        Timer t;
+        for (size_t round = 0; round < N / depth; round++) {
+            for (size_t i = 0; i < depth; i++) {
+                checksum += q[i];
+            }
+        }
+        return t.elapsed_ms();
+    }
+
+    template <typename QueueT>
+    void report(const char* name)
+    {
+        QueueT q;
+        uint64_t checksum = 0;
+        double fifo = 0;
+        double indexed = 0;
+        for (int i = 0; i < trials; i++) {
+            fifo += run_fifo(q, checksum);
+            indexed += run_indexed(q, checksum);
+        }
+        double mops = N / ((fifo / trials) * 1000.0);
+        std::cout << name << " FIFO avg over " << trials << " trials: "
+                  << (fifo / trials) << " ms (" << mops << " Mops/s)\n";
+        std::cout << name << " indexed scan avg over " << trials << " trials: "
+                  << (indexed / trials) << " ms\n";
+        std::cout << "  (checksum " << checksum << ")\n";
+    }
+
+public:
+    void runTests()
+    {
+        report<std::deque<uint64_t>>("std::deque");
+        report<DequeLite<uint64_t>>("DequeLite");
+    }
+};
+
+int main()
+{
+    std::cout << "=====Executing Queue Benchmark in C++=====\n";
+    std::cout << "Cycling 10,000,000 items through a 1024-deep FIFO\n";
+
+    QueueBenchmarks Tests;
+    Tests.runTests();
+}
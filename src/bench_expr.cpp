@@ -0,0 +1,153 @@
+#include "../include/VectorLiteExpr.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+struct Timer
+{
+    std::chrono::high_resolution_clock::time_point start;
+    Timer() { start = std::chrono::high_resolution_clock::now(); }
+    double elapsed_ms() const {
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+};
+
+/* The pre-expression-template style: every operator returns a fresh vector */
+static VectorLite<double> naive_mul(const VectorLite<double>& x, const VectorLite<double>& y)
+{
+    VectorLite<double> out(x.size());
+    for (size_t i = 0; i < x.size(); i++)
+        out.push_back(x[i] * y[i]);
+    return out;
+}
+
+static VectorLite<double> naive_add(const VectorLite<double>& x, const VectorLite<double>& y)
+{
+    VectorLite<double> out(x.size());
+    for (size_t i = 0; i < x.size(); i++)
+        out.push_back(x[i] + y[i]);
+    return out;
+}
+
+static VectorLite<double> naive_scale(const VectorLite<double>& x, double s)
+{
+    VectorLite<double> out(x.size());
+    for (size_t i = 0; i < x.size(); i++)
+        out.push_back(x[i] * s);
+    return out;
+}
+
+class ExprBenchmarks
+{
+private:
+    static constexpr size_t N = 10'000'000;
+    static constexpr int trials = 5;
+
+    VectorLite<double> b, c, d;
+
+    static void print(const char* name, double totalMs, double checksum)
+    {
+        std::cout << "  " << name << (totalMs / trials) << " ms (checksum " << checksum << ")\n";
+    }
+
+public:
+    ExprBenchmarks() : b(N), c(N), d(N)
+    {
+        std::mt19937_64 rng(7);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        for (size_t i = 0; i < N; i++) {
+            b.push_back(dist(rng));
+            c.push_back(dist(rng));
+            d.push_back(dist(rng));
+        }
+    }
+
+    void runTests()
+    {
+        std::cout << "--- a = b * c + d * 0.5 ---\n";
+        {
+            double total = 0, checksum = 0;
+            for (int i = 0; i < trials; i++) {
+                Timer t;
+                VectorLite<double> a = naive_add(naive_mul(b, c), naive_scale(d, 0.5));
+                total += t.elapsed_ms();
+                checksum += a[N / 2];
+            }
+            print("naive temporaries:   ", total, checksum);
+        }
+        {
+            VectorLite<double> a(N);
+            double total = 0, checksum = 0;
+            for (int i = 0; i < trials; i++) {
+                Timer t;
+                double* out = a.data();
+                const double* pb = b.data();
+                const double* pc = c.data();
+                const double* pd = d.data();
+                for (size_t j = 0; j < N; j++)
+                    out[j] = pb[j] * pc[j] + pd[j] * 0.5;
+                total += t.elapsed_ms();
+                checksum += out[N / 2];
+            }
+            print("hand-written loop:   ", total, checksum);
+        }
+        {
+            VectorLite<double> a(N);
+            double total = 0, checksum = 0;
+            for (int i = 0; i < trials; i++) {
+                Timer t;
+                a = b * c + d * 0.5;
+                total += t.elapsed_ms();
+                checksum += a[N / 2];
+            }
+            print("expression template: ", total, checksum);
+        }
+
+        std::cout << "--- sum(b * c) ---\n";
+        {
+            double total = 0, checksum = 0;
+            for (int i = 0; i < trials; i++) {
+                Timer t;
+                VectorLite<double> prod = naive_mul(b, c);
+                double s = 0;
+                for (size_t j = 0; j < N; j++)
+                    s += prod[j];
+                total += t.elapsed_ms();
+                checksum += s;
+            }
+            print("naive temporaries:   ", total, checksum);
+        }
+        {
+            double total = 0, checksum = 0;
+            for (int i = 0; i < trials; i++) {
+                Timer t;
+                double s = 0;
+                for (size_t j = 0; j < N; j++)
+                    s += b[j] * c[j];
+                total += t.elapsed_ms();
+                checksum += s;
+            }
+            print("hand-written loop:   ", total, checksum);
+        }
+        {
+            double total = 0, checksum = 0;
+            for (int i = 0; i < trials; i++) {
+                Timer t;
+                double s = vlexpr::dot(b, c);
+                total += t.elapsed_ms();
+                checksum += s;
+            }
+            print("expression template: ", total, checksum);
+        }
+    }
+};
+
+int main()
+{
+    std::cout << "=====Executing Expression Template Benchmark in C++=====\n";
+    std::cout << "Elementwise arithmetic over 10,000,000 doubles\n";
+
+    ExprBenchmarks Tests;
+    Tests.runTests();
+}
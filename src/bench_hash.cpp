@@ -0,0 +1,100 @@
+#include "../include/VectorLiteHash.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <thread>
+
+struct Timer
+{
+    std::chrono::high_resolution_clock::time_point start;
+    Timer() { start = std::chrono::high_resolution_clock::now(); }
+    double elapsed_ms() const {
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+};
+
+class HashBenchmarks
+{
+private:
+    static constexpr size_t N = 10'000'000;
+    static constexpr size_t rowCount = 200'000;
+    static constexpr size_t rowLength = 256;
+    static constexpr int trials = 5;
+
+    static VectorLite<uint32_t> random_ids(size_t distinct)
+    {
+        std::mt19937 rng(3);
+        VectorLite<uint32_t> ids(N);
+        for (size_t i = 0; i < N; i++) {
+            ids.push_back(static_cast<uint32_t>(rng() % distinct));
+        }
+        return ids;
+    }
+
+    void dedup_vs_sort(size_t distinct)
+    {
+        const VectorLite<uint32_t> ids = random_ids(distinct);
+        double hashMs = 0, sortMs = 0;
+        size_t hashKept = 0, sortKept = 0;
+        for (int i = 0; i < trials; i++) {
+            VectorLite<uint32_t> v = ids;
+            Timer t;
+            vlhash::dedup(v);
+            hashMs += t.elapsed_ms();
+            hashKept = v.size();
+
+            VectorLite<uint32_t> w = ids;
+            Timer s;
+            std::sort(w.data(), w.data() + w.size());
+            sortKept = static_cast<size_t>(std::unique(w.data(), w.data() + w.size()) - w.data());
+            sortMs += s.elapsed_ms();
+        }
+        std::cout << "--- dedup of " << N << " uint32, " << distinct << " distinct ---\n"
+                  << "  dedup (hash table, keeps order): " << hashMs / trials << " ms, kept " << hashKept << "\n"
+                  << "  std::sort + std::unique:         " << sortMs / trials << " ms, kept " << sortKept << "\n";
+    }
+
+public:
+    void runTests()
+    {
+        dedup_vs_sort(1'000);
+        dedup_vs_sort(1'000'000);
+
+        VectorLite<VectorLite<uint32_t>> rows(rowCount);
+        std::mt19937 rng(5);
+        for (size_t r = 0; r < rowCount; r++) {
+            VectorLite<uint32_t> row(rowLength);
+            for (size_t i = 0; i < rowLength; i++) {
+                row.push_back(rng());
+            }
+            rows.push_back(std::move(row));
+        }
+        const double gb = static_cast<double>(rowCount * rowLength * sizeof(uint32_t)) / 1e9;
+
+        std::cout << "--- batch_hash of " << rowCount << " rows x " << rowLength << " uint32 ---\n";
+        const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned threads : {1u, hw}) {
+            double total = 0;
+            size_t checksum = 0;
+            for (int i = 0; i < trials; i++) {
+                Timer t;
+                VectorLite<size_t> hashes = vlhash::batch_hash(rows, threads);
+                total += t.elapsed_ms();
+                checksum ^= hashes[rowCount / 2];
+            }
+            std::cout << "  " << threads << " thread(s): " << total / trials << " ms ("
+                      << gb / (total / trials / 1000) << " GB/s, checksum " << checksum << ")\n";
+        }
+    }
+};
+
+int main()
+{
+    std::cout << "=====Executing Hash / Dedup Benchmark in C++=====\n";
+
+    HashBenchmarks Tests;
+    Tests.runTests();
+}
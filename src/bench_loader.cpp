@@ -0,0 +1,199 @@
+#include "../include/VectorLiteLoader.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifndef VECTORLITE_RESULTS_DIR
+#define VECTORLITE_RESULTS_DIR "results"
+#endif
+
+struct Timer
+{
+    std::chrono::high_resolution_clock::time_point start;
+    Timer() { start = std::chrono::high_resolution_clock::now(); }
+    double elapsed_ms() const {
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+};
+
+/* Flushes the file and asks the kernel to drop its cached pages, so the next read comes from the device */
+static void evict_from_page_cache(const std::string& path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+    ::fdatasync(fd);
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(fd);
+}
+
+static const char* backend_name(LoaderBackend backend)
+{
+    return backend == LoaderBackend::IoUring ? "io_uring" : "pread threads";
+}
+
+class LoaderBenchmarks
+{
+private:
+    static constexpr int trials = 3;
+
+    size_t targetBytes;
+    std::string textPath;
+    std::string binaryPath;
+    std::ostringstream results;
+
+    void write_inputs()
+    {
+        std::mt19937_64 rng(11);
+        {
+            std::ofstream out(textPath, std::ios::binary);
+            std::string line;
+            size_t written = 0;
+            while (written < targetBytes) {
+                line = std::to_string(static_cast<int64_t>(rng() >> 20) - (int64_t{1} << 42)) + "\n";
+                out << line;
+                written += line.size();
+            }
+        }
+        {
+            std::ofstream out(binaryPath, std::ios::binary);
+            std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+            for (size_t i = 0; i < targetBytes / sizeof(float); i++) {
+                float value = dist(rng);
+                out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+        }
+    }
+
+    static size_t file_bytes(const std::string& path)
+    {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        return static_cast<size_t>(in.tellg());
+    }
+
+    /* Runs loadFn `trials` times and records the best GB/s; cold runs evict the file first */
+    template <typename LoadFn>
+    void measure(const std::string& label, const std::string& path, bool cold, LoadFn loadFn)
+    {
+        const double gb = static_cast<double>(file_bytes(path)) / 1e9;
+        double best = 0;
+        size_t records = 0;
+        for (int i = 0; i < trials; i++) {
+            if (cold)
+                evict_from_page_cache(path);
+            Timer t;
+            records = loadFn();
+            double gbs = gb / (t.elapsed_ms() / 1000);
+            best = gbs > best ? gbs : best;
+        }
+        std::ostringstream line;
+        line << "  " << label << (cold ? " [cold]" : " [warm]") << ": " << best << " GB/s (" << records << " records)\n";
+        std::cout << line.str();
+        results << line.str();
+    }
+
+    void run_text(bool cold)
+    {
+        measure("naive getline + stoll + push_back", textPath, cold, [&] {
+            std::ifstream in(textPath);
+            VectorLite<int64_t> values;
+            std::string line;
+            while (std::getline(in, line))
+                values.push_back(std::stoll(line));
+            return values.size();
+        });
+        for (LoaderBackend backend : {LoaderBackend::Pread, LoaderBackend::IoUring}) {
+            LoaderOptions opts;
+            opts.backend = backend;
+            try {
+                VectorLiteLoader loader(opts);
+                measure(std::string("VectorLiteLoader::load_lines, ") + backend_name(backend), textPath, cold, [&] {
+                    VectorLite<int64_t> values;
+                    return loader.load_lines(values, textPath).records;
+                });
+            } catch (const std::system_error& e) {
+                std::cout << "  " << backend_name(backend) << " unavailable: " << e.what() << "\n";
+            }
+        }
+    }
+
+    void run_binary(bool cold)
+    {
+        measure("naive istream::read + push_back", binaryPath, cold, [&] {
+            std::ifstream in(binaryPath, std::ios::binary);
+            VectorLite<float> values;
+            float value;
+            while (in.read(reinterpret_cast<char*>(&value), sizeof(value)))
+                values.push_back(value);
+            return values.size();
+        });
+        for (LoaderBackend backend : {LoaderBackend::Pread, LoaderBackend::IoUring}) {
+            LoaderOptions opts;
+            opts.backend = backend;
+            try {
+                VectorLiteLoader loader(opts);
+                measure(std::string("VectorLiteLoader::load_binary, ") + backend_name(backend), binaryPath, cold, [&] {
+                    VectorLite<float> values;
+                    return loader.load_binary(values, binaryPath).records;
+                });
+            } catch (const std::system_error& e) {
+                std::cout << "  " << backend_name(backend) << " unavailable: " << e.what() << "\n";
+            }
+        }
+    }
+
+public:
+    LoaderBenchmarks(size_t megabytes, const std::string& dir) :
+        targetBytes{ megabytes << 20 },
+        textPath{ dir + "/vectorlite_loader_bench.txt" },
+        binaryPath{ dir + "/vectorlite_loader_bench.f32" }
+    {}
+
+    ~LoaderBenchmarks()
+    {
+        std::remove(textPath.c_str());
+        std::remove(binaryPath.c_str());
+    }
+
+    void runTests()
+    {
+        write_inputs();
+        results << "VectorLiteLoader benchmark, " << (targetBytes >> 20) << " MiB inputs, "
+                << std::thread::hardware_concurrency() << " hardware threads\n";
+
+        for (bool cold : {false, true}) {
+            std::cout << "--- newline-delimited int64 text ---\n";
+            results << "--- newline-delimited int64 text ---\n";
+            run_text(cold);
+            std::cout << "--- binary float32 ---\n";
+            results << "--- binary float32 ---\n";
+            run_binary(cold);
+        }
+
+        const std::string out = std::string(VECTORLITE_RESULTS_DIR) + "/loader_bench.txt";
+        std::ofstream file(out);
+        file << results.str();
+        std::cout << (file ? "results written to " : "could not write ") << out << "\n";
+    }
+};
+
+/* Usage: loader_bench [MiB per input file, default 256] [scratch directory, default /tmp] */
+int main(int argc, char** argv)
+{
+    const size_t megabytes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 256;
+    const std::string dir = argc > 2 ? argv[2] : "/tmp";
+
+    std::cout << "=====Executing Chunked Loader Benchmark in C++=====\n";
+
+    LoaderBenchmarks Tests(megabytes, dir);
+    Tests.runTests();
+}
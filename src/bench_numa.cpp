@@ -0,0 +1,173 @@
+#include "../include/Vector.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+struct Timer
+{
+    std::chrono::high_resolution_clock::time_point start;
+    Timer() { start = std::chrono::high_resolution_clock::now(); }
+    double elapsed_ms() const {
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+};
+
+/* CPUs of a NUMA node from sysfs, e.g. "0-15,32-47"; empty if unknown */
+static std::vector<int> node_cpus(int node)
+{
+    std::vector<int> cpus;
+    std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string list;
+    if (!std::getline(in, list))
+        return cpus;
+    std::stringstream ranges(list);
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+        size_t dash = range.find('-');
+        int first = std::stoi(range.substr(0, dash));
+        int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int cpu = first; cpu <= last; cpu++)
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+static void pin_to_cpu(int cpu)
+{
+#if defined(__linux__)
+    if (cpu < 0)
+        return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+/* Pins the calling thread to cpu for its lifetime, then restores the previous CPU set */
+class ScopedPin
+{
+#if defined(__linux__)
+    cpu_set_t previous;
+    bool saved;
+#endif
+public:
+    explicit ScopedPin(int cpu)
+    {
+#if defined(__linux__)
+        saved = pthread_getaffinity_np(pthread_self(), sizeof(previous), &previous) == 0;
+#endif
+        pin_to_cpu(cpu);
+    }
+    ~ScopedPin()
+    {
+#if defined(__linux__)
+        if (saved)
+            pthread_setaffinity_np(pthread_self(), sizeof(previous), &previous);
+#endif
+    }
+};
+
+class NumaBenchmarks
+{
+private:
+    static constexpr size_t N = 32'000'000; // 256 MB of uint64_t
+    static constexpr int trials = 5;
+
+    /* Each worker sums its own contiguous slice; returns GB/s */
+    static double scan(const VectorLite<uint64_t>& v, const std::vector<int>& cpus, uint64_t& checksum)
+    {
+        const size_t workers = cpus.size();
+        std::vector<uint64_t> sums(workers * 8, 0); // one cache line per worker
+        Timer t;
+        std::vector<std::thread> pool;
+        for (size_t w = 0; w < workers; w++) {
+            pool.emplace_back([&, w] {
+                pin_to_cpu(cpus[w]);
+                size_t begin = v.size() * w / workers;
+                size_t end = v.size() * (w + 1) / workers;
+                uint64_t sum = 0;
+                for (size_t i = begin; i < end; i++)
+                    sum += v[i];
+                sums[w * 8] = sum;
+            });
+        }
+        for (std::thread& th : pool)
+            th.join();
+        double ms = t.elapsed_ms();
+        for (size_t w = 0; w < workers; w++)
+            checksum += sums[w * 8];
+        return static_cast<double>(v.size() * sizeof(uint64_t)) / (ms * 1e6);
+    }
+
+    static void report(const char* name, const VectorLiteAllocOptions& opts, const std::vector<int>& cpus)
+    {
+        VectorLite<uint64_t> v(N, opts);
+        {
+            // first touch happens here, after the policy is set; fill from a reader's CPU so
+            // first-touch placement ("default", "NUMA local") lands on the readers' node
+            ScopedPin pin(cpus.empty() ? -1 : cpus[0]);
+            for (uint64_t i = 0; i < N; i++)
+                v.push_back(i);
+        }
+        uint64_t checksum = 0;
+        double best = 0;
+        double total = 0;
+        for (int i = 0; i < trials; i++) {
+            double gbs = scan(v, cpus, checksum);
+            best = std::max(best, gbs);
+            total += gbs;
+        }
+        std::cout << name << ": avg " << total / trials << " GB/s, best " << best
+                  << " GB/s (checksum " << checksum << ")\n";
+    }
+
+public:
+    void runTests()
+    {
+        const int nodes = alloc_detail::numa_node_count();
+        std::vector<int> readers = node_cpus(0);
+        if (readers.empty()) {
+            for (unsigned cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); cpu++)
+                readers.push_back(static_cast<int>(cpu));
+        }
+        std::cout << nodes << " NUMA node(s) visible, scanning with " << readers.size()
+                  << " thread(s) pinned to node 0\n";
+
+        report("default (natural alignment, first touch)", VectorLiteAllocOptions{}, readers);
+        report("64-byte aligned", VectorLiteAllocOptions::cache_aligned(), readers);
+        report("page aligned", VectorLiteAllocOptions::page_aligned(), readers);
+
+        VectorLiteAllocOptions local;
+        local.numa = NumaPolicy::Local;
+        report("NUMA local", local, readers);
+        report("NUMA interleaved", VectorLiteAllocOptions::interleaved(), readers);
+        for (int node = 0; node < nodes; node++) {
+            std::string label = "NUMA bound to node " + std::to_string(node)
+                              + (node == 0 ? " (local to readers)" : " (remote to readers)");
+            report(label.c_str(), VectorLiteAllocOptions::on_node(node), readers);
+        }
+    }
+};
+
+int main()
+{
+    std::cout << "=====Executing NUMA Placement Benchmark in C++=====\n";
+    std::cout << "Parallel scan of a 256 MB VectorLite<uint64_t>\n";
+
+    NumaBenchmarks Tests;
+    Tests.runTests();
+}
@@ -0,0 +1,83 @@
+#include "../include/VectorLiteRegistry.h"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+
+struct Timer
+{
+    std::chrono::high_resolution_clock::time_point start;
+    Timer() { start = std::chrono::high_resolution_clock::now(); }
+    double elapsed_ms() const {
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+};
+
+class RegistryBenchmarks
+{
+private:
+    static constexpr size_t pushes = 20'000'000;
+    static constexpr size_t vectorCount = 100'000;
+
+    /* Tracking lives outside the push_back path, so both loops should cost the same */
+    static double time_pushes(bool tracked)
+    {
+        VectorLite<uint32_t> vec;
+        if (tracked)
+            vec.track("bench.pushes");
+        Timer t;
+        for (size_t i = 0; i < pushes; i++)
+            vec.push_back(static_cast<uint32_t>(i));
+        return t.elapsed_ms();
+    }
+
+public:
+    void runTests()
+    {
+        std::cout << "--- push_back x " << pushes << " ---\n"
+                  << "  untracked: " << time_pushes(false) << " ms\n"
+                  << "  tracked:   " << time_pushes(true) << " ms\n";
+
+        // many small vectors over-reserved by a guessed size, the pattern the report is meant to expose
+        std::mt19937 rng(3);
+        VectorLite<VectorLite<uint64_t>> rows(vectorCount);
+        Timer trackTimer;
+        for (size_t i = 0; i < vectorCount; i++) {
+            rows.push_back(VectorLite<uint64_t>(256));
+            rows[i].track(i % 2 ? "bench.rows.odd" : "bench.rows.even");
+            const size_t fill = rng() % 64;
+            for (size_t j = 0; j < fill; j++)
+                rows[i].push_back(j);
+        }
+        const double trackMs = trackTimer.elapsed_ms();
+
+        VectorLiteRegistry& registry = VectorLiteRegistry::instance();
+        Timer reportTimer;
+        VectorLiteReport report = registry.report();
+        const double reportMs = reportTimer.elapsed_ms();
+        Timer jsonTimer;
+        const std::string json = report.to_json();
+        const double jsonMs = jsonTimer.elapsed_ms();
+
+        Timer shrinkTimer;
+        const size_t released = registry.shrink_all_over(256);
+        const double shrinkMs = shrinkTimer.elapsed_ms();
+
+        std::cout << "--- " << vectorCount << " tracked vectors ---\n"
+                  << "  track + fill:     " << trackMs << " ms\n"
+                  << "  report:           " << reportMs << " ms (" << report.total.slackBytes / (1 << 20) << " MiB slack of "
+                  << report.total.capacityBytes / (1 << 20) << " MiB)\n"
+                  << "  to_json:          " << jsonMs << " ms (" << json.size() << " bytes)\n"
+                  << "  shrink_all_over:  " << shrinkMs << " ms (" << released / (1 << 20) << " MiB released)\n";
+    }
+};
+
+int main()
+{
+    std::cout << "=====Executing Registry Benchmark in C++=====\n";
+
+    RegistryBenchmarks Tests;
+    Tests.runTests();
+}
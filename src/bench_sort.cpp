@@ -0,0 +1,108 @@
+#include "../include/VectorLiteSort.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+
+struct Timer
+{
+    std::chrono::high_resolution_clock::time_point start;
+    Timer() { start = std::chrono::high_resolution_clock::now(); }
+    double elapsed_ms() const {
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+};
+
+class SortBenchmarks
+{
+private:
+    static constexpr int trials = 3;
+
+    /* Sorts a fresh copy each trial so every run sees the same unsorted input */
+    template <typename T, typename SortFn>
+    static double time_sort(const VectorLite<T>& input, SortFn sortFn)
+    {
+        double total = 0;
+        for (int i = 0; i < trials; i++) {
+            VectorLite<T> v = input;
+            Timer t;
+            sortFn(v);
+            total += t.elapsed_ms();
+        }
+        return total / trials;
+    }
+
+    template <typename T>
+    static void report(const std::string& name, const VectorLite<T>& input)
+    {
+        const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+        auto less = [](const T& a, const T& b) { return a < b; };
+        std::cout << "--- " << name << ", n = " << input.size() << " ---\n"
+                  << "  std::sort:                " << time_sort(input, [&](VectorLite<T>& v) { std::sort(v.data(), v.data() + v.size(), less); }) << " ms\n"
+                  << "  std::stable_sort:         " << time_sort(input, [&](VectorLite<T>& v) { std::stable_sort(v.data(), v.data() + v.size(), less); }) << " ms\n"
+                  << "  radix_sort 8-bit:         " << time_sort(input, [](VectorLite<T>& v) { radix_sort(v, RadixDigits::Bits8); }) << " ms\n"
+                  << "  radix_sort 11-bit:        " << time_sort(input, [](VectorLite<T>& v) { radix_sort(v, RadixDigits::Bits11); }) << " ms\n"
+                  << "  radix_sort 16-bit:        " << time_sort(input, [](VectorLite<T>& v) { radix_sort(v, RadixDigits::Bits16); }) << " ms\n"
+                  << "  parallel_radix_sort (" << hw << "t): " << time_sort(input, [](VectorLite<T>& v) { parallel_radix_sort(v); }) << " ms\n";
+    }
+
+    static void report_pairs(size_t n)
+    {
+        using Pair = std::pair<uint32_t, uint32_t>;
+        std::mt19937 rng(9);
+        VectorLite<Pair> input(n);
+        for (size_t i = 0; i < n; i++) {
+            input.push_back({rng(), static_cast<uint32_t>(i)});
+        }
+        auto byKey = [](const Pair& a, const Pair& b) { return a.first < b.first; };
+        auto key = [](const Pair& p) { return p.first; };
+        std::cout << "--- (uint32 key, uint32 payload) pairs, n = " << n << " ---\n"
+                  << "  std::stable_sort:         " << time_sort(input, [&](VectorLite<Pair>& v) { std::stable_sort(v.data(), v.data() + v.size(), byKey); }) << " ms\n"
+                  << "  radix_sort_by_key:        " << time_sort(input, [&](VectorLite<Pair>& v) { radix_sort_by_key(v, key); }) << " ms\n"
+                  << "  parallel_radix_sort_by_key: " << time_sort(input, [&](VectorLite<Pair>& v) { parallel_radix_sort_by_key(v, key); }) << " ms\n";
+    }
+
+public:
+    void runTests()
+    {
+        for (size_t n : {size_t{1'000'000}, size_t{10'000'000}}) {
+            std::mt19937_64 rng(n);
+
+            VectorLite<uint32_t> uniform32(n);
+            for (size_t i = 0; i < n; i++)
+                uniform32.push_back(static_cast<uint32_t>(rng()));
+            report("uniform uint32", uniform32);
+
+            VectorLite<uint32_t> lowCard(n);
+            for (size_t i = 0; i < n; i++)
+                lowCard.push_back(static_cast<uint32_t>(rng() % 256));
+            report("uint32 with 256 distinct values", lowCard);
+
+            VectorLite<int64_t> signed64(n);
+            for (size_t i = 0; i < n; i++)
+                signed64.push_back(static_cast<int64_t>(rng()));
+            report("uniform int64 (signed)", signed64);
+
+            std::normal_distribution<float> normal(0.0f, 1000.0f);
+            VectorLite<float> floats(n);
+            for (size_t i = 0; i < n; i++)
+                floats.push_back(normal(rng));
+            report("normal float", floats);
+
+            report_pairs(n);
+        }
+    }
+};
+
+int main()
+{
+    std::cout << "=====Executing Sort Benchmark in C++=====\n";
+
+    SortBenchmarks Tests;
+    Tests.runTests();
+}
@@ -0,0 +1,194 @@
+#include "../include/SpscRingLite.h"
+#include "../include/DequeLite.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+struct Timer
+{
+    std::chrono::high_resolution_clock::time_point start;
+    Timer() { start = std::chrono::high_resolution_clock::now(); }
+    double elapsed_ms() const {
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+};
+
+/* Pins the calling thread to one CPU; silently does nothing where unsupported */
+static void pin_to_cpu(unsigned cpu)
+{
+#if defined(__linux__)
+    unsigned cpus = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % cpus, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+/* The baseline the pipeline used before: a mutex-protected queue */
+class MutexQueue
+{
+private:
+    DequeLite<uint64_t> q;
+    std::mutex m;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    size_t limit;
+public:
+    MutexQueue(size_t capacity) : q(capacity), limit(capacity) {}
+
+    void push(uint64_t value)
+    {
+        std::unique_lock<std::mutex> lock(m);
+        notFull.wait(lock, [this] { return q.size() < limit; });
+        q.push_back(value);
+        notEmpty.notify_one();
+    }
+
+    uint64_t pop()
+    {
+        std::unique_lock<std::mutex> lock(m);
+        notEmpty.wait(lock, [this] { return !q.empty(); });
+        uint64_t value = q.front();
+        q.pop_front();
+        notFull.notify_one();
+        return value;
+    }
+};
+
+class SpscBenchmarks
+{
+private:
+    static constexpr uint64_t N = 10'000'000;
+    static constexpr size_t ring_capacity = 4096;
+    static constexpr size_t batch = 64;
+    static constexpr uint64_t pings = 100'000;
+    static constexpr int trials = 3;
+
+    template <typename QueueT>
+    double run_single(QueueT& q, uint64_t& checksum)
+    {
+        Timer t;
+        std::thread producer([&q] {
+            pin_to_cpu(0);
+            for (uint64_t i = 0; i < N; i++) {
+                q.push(i);
+            }
+        });
+        pin_to_cpu(1);
+        for (uint64_t i = 0; i < N; i++) {
+            checksum += q.pop();
+        }
+        producer.join();
+        return t.elapsed_ms();
+    }
+
+    double run_batched(SpscRingLite<uint64_t>& q, uint64_t& checksum)
+    {
+        Timer t;
+        std::thread producer([&q] {
+            pin_to_cpu(0);
+            uint64_t buf[batch];
+            for (uint64_t i = 0; i < N; i += batch) {
+                for (size_t j = 0; j < batch; j++) {
+                    buf[j] = i + j;
+                }
+                q.push_n(buf, batch);
+            }
+        });
+        pin_to_cpu(1);
+        uint64_t buf[batch];
+        uint64_t received = 0;
+        while (received < N) {
+            size_t got = q.pop_n(buf, batch);
+            for (size_t j = 0; j < got; j++) {
+                checksum += buf[j];
+            }
+            received += got;
+        }
+        producer.join();
+        return t.elapsed_ms();
+    }
+
+    /* Round trip through two rings; half of it is the one-way latency */
+    double run_ping_pong(SpscWaitMode mode)
+    {
+        SpscRingLite<uint64_t> ping(64, mode);
+        SpscRingLite<uint64_t> pong(64, mode);
+        std::thread echo([&] {
+            pin_to_cpu(0);
+            for (uint64_t i = 0; i < pings; i++) {
+                pong.push(ping.pop());
+            }
+        });
+        pin_to_cpu(1);
+        Timer t;
+        for (uint64_t i = 0; i < pings; i++) {
+            ping.push(i);
+            pong.pop();
+        }
+        double ms = t.elapsed_ms();
+        echo.join();
+        return ms * 1e6 / pings; // ns per round trip
+    }
+
+    static void report(const char* name, double totalMs, uint64_t checksum)
+    {
+        double avg = totalMs / trials;
+        std::cout << name << " avg over " << trials << " trials: " << avg << " ms ("
+                  << (N / (avg * 1000.0)) << " Mitems/s, checksum " << checksum << ")\n";
+    }
+
+public:
+    void runTests()
+    {
+        {
+            uint64_t checksum = 0;
+            double total = 0;
+            for (int i = 0; i < trials; i++) {
+                MutexQueue q(ring_capacity);
+                total += run_single(q, checksum);
+            }
+            report("mutex + DequeLite", total, checksum);
+        }
+
+        for (SpscWaitMode mode : {SpscWaitMode::NonBlocking, SpscWaitMode::SpinThenPark}) {
+            const char* label = mode == SpscWaitMode::NonBlocking ? "non-blocking" : "spin-then-park";
+            uint64_t checksum = 0;
+            double single = 0;
+            double batched = 0;
+            for (int i = 0; i < trials; i++) {
+                SpscRingLite<uint64_t> q(ring_capacity, mode);
+                single += run_single(q, checksum);
+                batched += run_batched(q, checksum);
+            }
+            std::cout << "--- SpscRingLite (" << label << ") ---\n";
+            report("  push/pop", single, checksum);
+            report("  push_n/pop_n x64", batched, checksum);
+            std::cout << "  ping-pong round trip: " << run_ping_pong(mode) << " ns\n";
+        }
+    }
+};
+
+int main()
+{
+    std::cout << "=====Executing SPSC Queue Benchmark in C++=====\n";
+    std::cout << "Passing 10,000,000 items between two pinned threads\n";
+    if (std::thread::hardware_concurrency() < 2)
+        std::cout << "(warning: fewer than 2 CPUs, threads share a core)\n";
+
+    SpscBenchmarks Tests;
+    Tests.runTests();
+}
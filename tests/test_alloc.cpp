@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "Vector.h"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+static bool aligned_to(const void* ptr, size_t alignment)
+{
+    return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+}
+
+TEST(Alloc, DefaultOptions_UseNaturalAlignment) {
+    VectorLite<double> vec;
+    EXPECT_EQ(vec.alloc_options().alignment, 0);
+    EXPECT_EQ(vec.alloc_options().numa, NumaPolicy::Default);
+    vec.push_back(1.0);
+    EXPECT_TRUE(aligned_to(&vec[0], alignof(double)));
+}
+
+TEST(Alloc, CacheAligned_SurvivesGrowth) {
+    VectorLite<int> vec(3, VectorLiteAllocOptions::cache_aligned());
+    for (int i = 0; i < 1000; ++i) {
+        vec.push_back(i);
+        ASSERT_TRUE(aligned_to(&vec[0], 64));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(vec[i], i);
+    }
+    EXPECT_EQ(vec.alloc_options().alignment, 64);
+}
+
+TEST(Alloc, PageAligned_CopyKeepsOptions) {
+    VectorLite<std::string> vec(4, VectorLiteAllocOptions::page_aligned());
+    vec.push_back("hello");
+    vec.push_back("world");
+    EXPECT_TRUE(aligned_to(&vec[0], 4096));
+
+    VectorLite<std::string> copy(vec);
+    EXPECT_TRUE(copy == vec);
+    EXPECT_TRUE(copy.alloc_options() == vec.alloc_options());
+    EXPECT_TRUE(aligned_to(&copy[0], 4096));
+}
+
+TEST(Alloc, Swap_MovesOptionsWithTheBuffer) {
+    VectorLite<int> aligned(8, VectorLiteAllocOptions::cache_aligned());
+    VectorLite<int> plain({1, 2, 3});
+    swap(aligned, plain);
+    EXPECT_EQ(aligned.alloc_options().alignment, 0);
+    EXPECT_EQ(plain.alloc_options().alignment, 64);
+    EXPECT_EQ(aligned.size(), 3);
+    plain.reserve(100);
+    plain.push_back(4);
+    EXPECT_TRUE(aligned_to(&plain[0], 64));
+}
+
+TEST(Alloc, Alignment_RejectsNonPowersOfTwo) {
+    VectorLiteAllocOptions opts;
+    opts.alignment = 48;
+    EXPECT_THROW(VectorLite<int>(8, opts), std::invalid_argument);
+    opts.alignment = 4097;
+    EXPECT_THROW(VectorLite<char>(8, opts), std::invalid_argument);
+
+    opts.alignment = 1; // a power of two below alignof(T) just means natural alignment
+    VectorLite<double> vec(8, opts);
+    vec.push_back(2.0);
+    EXPECT_TRUE(aligned_to(&vec[0], alignof(double)));
+}
+
+/* mbind may be unavailable (single node, containers); the buffer must still work */
+TEST(Alloc, NumaPolicies_AllocateUsableBuffers) {
+    VectorLiteAllocOptions policies[] = {
+        VectorLiteAllocOptions::interleaved(),
+        VectorLiteAllocOptions::on_node(0),
+    };
+    VectorLiteAllocOptions local;
+    local.numa = NumaPolicy::Local;
+
+    for (VectorLiteAllocOptions opts : {policies[0], policies[1], local}) {
+        opts.numaThreshold = 4096;
+        VectorLite<uint64_t> vec(1 << 16, opts);
+        for (uint64_t i = 0; i < (1 << 17); ++i) {
+            vec.push_back(i);
+        }
+        EXPECT_EQ(vec.size(), 1u << 17);
+        EXPECT_EQ(vec[12345], 12345u);
+        EXPECT_TRUE(aligned_to(&vec[0], 4096));
+    }
+    EXPECT_GE(alloc_detail::numa_node_count(), 1);
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include "BitVectorLite.h"
+#include <stdexcept>
+#include <utility>
+
+TEST(BitVector, DefaultConstructor_CreatesEmptyBitVector) {
+    BitVectorLite bv;
+    EXPECT_EQ(bv.size(), 0);
+    EXPECT_TRUE(bv.empty());
+    EXPECT_EQ(bv.count(), 0);
+    EXPECT_EQ(bv.find_first(), BitVectorLite::npos);
+}
+
+TEST(BitVector, PushBack_PacksSixtyFourFlagsPerWord) {
+    BitVectorLite bv;
+    for (size_t i = 0; i < 130; ++i) {
+        bv.push_back(i % 3 == 0);
+    }
+    EXPECT_EQ(bv.size(), 130);
+    EXPECT_EQ(bv.word_count(), 3);
+    for (size_t i = 0; i < 130; ++i) {
+        EXPECT_EQ(bv[i], i % 3 == 0);
+    }
+    EXPECT_EQ(bv.count(), 44);
+
+    bv.pop_back(); // index 129 is set
+    EXPECT_EQ(bv.count(), 43);
+    EXPECT_EQ(bv.word_count(), 3);
+    bv.pop_back();
+    EXPECT_EQ(bv.word_count(), 2);
+}
+
+TEST(BitVector, ProxyReference_ReadsAndWrites) {
+    BitVectorLite bv(10, false);
+    bv[3] = true;
+    bv[7] = bv[3];
+    bv.at(9).flip();
+    EXPECT_TRUE(bv[3]);
+    EXPECT_TRUE(bv[7]);
+    EXPECT_TRUE(bv[9]);
+    EXPECT_EQ(bv.count(), 3);
+    EXPECT_THROW(bv.at(10), std::out_of_range);
+
+    for (auto bit : bv) {
+        bit = true;
+    }
+    EXPECT_TRUE(bv.all());
+}
+
+TEST(BitVector, BulkOps_WorkWordAtATime) {
+    BitVectorLite a(200, false);
+    BitVectorLite b(200, false);
+    for (size_t i = 0; i < 200; i += 2) a[i] = true;
+    for (size_t i = 0; i < 200; i += 3) b[i] = true;
+
+    EXPECT_EQ((a & b).count(), 34);  // multiples of 6
+    EXPECT_EQ((a | b).count(), 133);
+    EXPECT_EQ((a ^ b).count(), 99);
+    EXPECT_EQ((~a).count(), 100);
+
+    BitVectorLite c(199, false);
+    EXPECT_THROW(a &= c, std::invalid_argument);
+}
+
+TEST(BitVector, Flip_KeepsUnusedBitsClear) {
+    BitVectorLite bv(70, false);
+    bv.flip();
+    EXPECT_EQ(bv.count(), 70);
+    EXPECT_TRUE(bv.all());
+    bv.push_back(false);
+    EXPECT_EQ(bv.count(), 70);
+    EXPECT_FALSE(bv[70]);
+}
+
+TEST(BitVector, FindFirstAndNext_VisitSetBitsInOrder) {
+    BitVectorLite bv(1000, false);
+    size_t positions[] = {5, 63, 64, 200, 999};
+    for (size_t pos : positions) bv[pos] = true;
+
+    size_t visited = 0;
+    for (size_t pos = bv.find_first(); pos != BitVectorLite::npos; pos = bv.find_next(pos)) {
+        ASSERT_LT(visited, 5);
+        EXPECT_EQ(pos, positions[visited]);
+        visited++;
+    }
+    EXPECT_EQ(visited, 5);
+}
+
+TEST(BitVector, Count_MatchesBitByBitAcrossLengths) {
+    for (size_t len : {1u, 63u, 64u, 65u, 255u, 256u, 1000u}) {
+        BitVectorLite bv(len, false);
+        size_t expected = 0;
+        for (size_t i = 0; i < len; ++i) {
+            if ((i * 7919) % 5 < 2) {
+                bv[i] = true;
+                expected++;
+            }
+        }
+        EXPECT_EQ(bv.count(), expected);
+    }
+}
+
+TEST(BitVector, Move_StealsWordsAndLeavesSourceReusable) {
+    BitVectorLite source(130, true);
+    BitVectorLite moved(std::move(source));
+    EXPECT_EQ(moved.size(), 130);
+    EXPECT_EQ(moved.count(), 130);
+    EXPECT_EQ(source.size(), 0);
+    EXPECT_EQ(source.word_count(), 0);
+
+    source.push_back(true);
+    source.push_back(false);
+    EXPECT_EQ(source.count(), 1);
+}
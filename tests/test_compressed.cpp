@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "CompressedVectorLite.h"
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+TEST(Compressed, DefaultConstructor_CreatesEmptyColumn) {
+    CompressedVectorLite<uint32_t> cv;
+    EXPECT_EQ(cv.size(), 0);
+    EXPECT_TRUE(cv.empty());
+    EXPECT_EQ(cv.block_count(), 0);
+    EXPECT_THROW(cv.at(0), std::out_of_range);
+}
+
+TEST(Compressed, SortedIds_RoundTripAndShrink) {
+    VectorLite<uint32_t> ids;
+    std::mt19937 rng(42);
+    uint32_t id = 1'000'000;
+    for (size_t i = 0; i < 100'000; ++i) {
+        id += 1 + rng() % 16;
+        ids.push_back(id);
+    }
+
+    CompressedVectorLite<uint32_t> cv(ids);
+    EXPECT_EQ(cv.size(), ids.size());
+    EXPECT_TRUE(cv.decompress() == ids);
+    EXPECT_LT(cv.memory_bytes() * 3, cv.raw_bytes());
+}
+
+TEST(Compressed, UnsortedAndExtremeValues_RoundTrip) {
+    VectorLite<uint64_t> values;
+    std::mt19937_64 rng(7);
+    for (size_t i = 0; i < 1000; ++i) {
+        values.push_back(i % 17 == 0 ? std::numeric_limits<uint64_t>::max() : rng());
+    }
+    CompressedVectorLite<uint64_t> cv(values);
+    EXPECT_TRUE(cv.decompress() == values);
+}
+
+TEST(Compressed, SignedValues_RoundTrip) {
+    VectorLite<int32_t> values;
+    for (int32_t i = 0; i < 500; ++i) {
+        values.push_back((i % 2 ? -1 : 1) * i * 1000);
+    }
+    values.push_back(std::numeric_limits<int32_t>::min());
+    values.push_back(std::numeric_limits<int32_t>::max());
+
+    CompressedVectorLite<int32_t> cv(values);
+    EXPECT_TRUE(cv.decompress() == values);
+}
+
+TEST(Compressed, RandomAccess_MatchesSourceInEveryBlock) {
+    VectorLite<uint64_t> timestamps;
+    uint64_t ts = 1'700'000'000'000ULL;
+    for (size_t i = 0; i < 1000; ++i) {
+        ts += (i * 37) % 101;
+        timestamps.push_back(ts);
+    }
+    CompressedVectorLite<uint64_t> cv(timestamps);
+    EXPECT_EQ(cv.block_count(), 8); // 7 full blocks + tail
+
+    for (size_t i = 0; i < timestamps.size(); ++i) {
+        EXPECT_EQ(cv[i], timestamps[i]);
+    }
+    EXPECT_EQ(cv.at(999), timestamps[999]);
+}
+
+TEST(Compressed, RandomAccess_AroundCheckpointsWithUnsortedSigned) {
+    std::mt19937 rng(12);
+    VectorLite<int32_t> values;
+    for (size_t i = 0; i < 3 * 128 + 17; ++i) {
+        values.push_back(static_cast<int32_t>(rng()));
+    }
+    CompressedVectorLite<int32_t> cv(values);
+    for (size_t block = 0; block < 3; ++block) {
+        for (size_t pos : {0, 1, 31, 32, 33, 63, 64, 65, 95, 96, 97, 127}) {
+            const size_t i = block * 128 + pos;
+            EXPECT_EQ(cv[i], values[i]) << "index " << i;
+        }
+    }
+    EXPECT_EQ(cv[3 * 128 + 16], values[3 * 128 + 16]);
+}
+
+TEST(Compressed, ConstantRun_UsesZeroWidthBlocks) {
+    CompressedVectorLite<uint32_t> cv;
+    for (uint32_t i = 0; i < 256; ++i) {
+        cv.push_back(5 + 3 * i);
+    }
+    EXPECT_EQ(cv.block_count(), 2);
+    EXPECT_EQ(cv[200], 5 + 3 * 200);
+    size_t expected = 0;
+    for (uint32_t value : cv) {
+        EXPECT_EQ(value, 5 + 3 * expected);
+        expected++;
+    }
+    EXPECT_EQ(expected, 256);
+}
+
+TEST(Compressed, Iterator_DecodesAcrossBlockBoundaries) {
+    CompressedVectorLite<uint16_t> cv;
+    for (uint32_t i = 0; i < 300; ++i) {
+        cv.push_back(static_cast<uint16_t>(i * i));
+    }
+    uint32_t i = 0;
+    for (auto it = cv.begin(); it != cv.end(); ++it, ++i) {
+        EXPECT_EQ(*it, static_cast<uint16_t>(i * i));
+    }
+    EXPECT_EQ(i, 300);
+}
@@ -89,7 +89,7 @@ TEST(Construction, MoveConstructor_TakesOwnershipAndInvalidatesSource) {
     }
     
     EXPECT_EQ(original.size(), 0);
-    EXPECT_EQ(original.capacity(), 4);
+    EXPECT_EQ(original.capacity(), 0); // the buffer went with the move
     EXPECT_TRUE(original.empty());
 }
 
@@ -102,6 +102,6 @@ TEST(Construction, MoveConstructor_WorksWithEmptyVectorLite) {
     EXPECT_TRUE(moved.empty());
     
     EXPECT_EQ(original.size(), 0);
-    EXPECT_EQ(original.capacity(), 4);
+    EXPECT_EQ(original.capacity(), 0); // the buffer went with the move
     EXPECT_TRUE(original.empty());
 }
\ No newline at end of file
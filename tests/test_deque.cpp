@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "DequeLite.h"
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+TEST(Deque, DefaultConstructor_CreatesEmptyDeque) {
+    DequeLite<int> dq;
+    EXPECT_EQ(dq.size(), 0);
+    EXPECT_EQ(dq.capacity(), 4);
+    EXPECT_TRUE(dq.empty());
+}
+
+TEST(Deque, PushBackPopFront_IsFifo) {
+    DequeLite<int> dq;
+    for (int i = 0; i < 10; ++i) {
+        dq.push_back(i);
+    }
+    EXPECT_EQ(dq.size(), 10);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(dq.front(), i);
+        dq.pop_front();
+    }
+    EXPECT_TRUE(dq.empty());
+}
+
+TEST(Deque, PushFront_PrependsElements) {
+    DequeLite<int> dq({3, 4});
+    dq.push_front(2);
+    dq.push_front(1);
+    dq.push_back(5);
+
+    EXPECT_EQ(dq.size(), 5);
+    for (size_t i = 0; i < dq.size(); ++i) {
+        EXPECT_EQ(dq[i], static_cast<int>(i) + 1);
+    }
+    EXPECT_EQ(dq.front(), 1);
+    EXPECT_EQ(dq.back(), 5);
+}
+
+TEST(Deque, Growth_PreservesOrderWhenWrapped) {
+    DequeLite<int> dq(4);
+    dq.push_back(1);
+    dq.push_back(2);
+    dq.pop_front();
+    dq.pop_front();
+    // head is now in the middle of the ring
+    for (int i = 0; i < 9; ++i) {
+        dq.push_back(i);
+    }
+    EXPECT_GE(dq.capacity(), 9);
+    for (int i = 0; i < 9; ++i) {
+        EXPECT_EQ(dq[i], i);
+    }
+}
+
+TEST(Deque, Bounded_OverwritesOldest) {
+    DequeLite<int> dq(3, DequeOverflow::OverwriteOldest);
+    for (int i = 1; i <= 5; ++i) {
+        dq.push_back(i);
+    }
+    EXPECT_EQ(dq.capacity(), 3);
+    EXPECT_TRUE(dq.full());
+    EXPECT_EQ(dq[0], 3);
+    EXPECT_EQ(dq[1], 4);
+    EXPECT_EQ(dq[2], 5);
+
+    dq.push_front(0); // evicts the back
+    EXPECT_EQ(dq[0], 0);
+    EXPECT_EQ(dq[1], 3);
+    EXPECT_EQ(dq[2], 4);
+}
+
+TEST(Deque, Linearize_MakesElementsContiguous) {
+    DequeLite<std::string> dq(4);
+    dq.push_back("b");
+    dq.push_back("c");
+    dq.push_front("a");
+    dq.push_back("d");
+
+    std::string* first = dq.linearize();
+    EXPECT_EQ(first[0], "a");
+    EXPECT_EQ(first[1], "b");
+    EXPECT_EQ(first[2], "c");
+    EXPECT_EQ(first[3], "d");
+    EXPECT_EQ(&dq[0], first);
+}
+
+TEST(Deque, AtAndPop_ThrowOnOutOfBounds) {
+    DequeLite<int> dq({1, 2});
+    EXPECT_EQ(dq.at(1), 2);
+    EXPECT_THROW(dq.at(2), std::out_of_range);
+    dq.pop();
+    dq.pop();
+    EXPECT_THROW(dq.pop(), std::out_of_range);
+}
+
+TEST(Deque, CopyAndMove_PreserveLogicalOrder) {
+    DequeLite<int> original(4);
+    original.push_back(2);
+    original.push_back(3);
+    original.push_front(1);
+    original.push_front(0);
+
+    DequeLite<int> copy(original);
+    EXPECT_TRUE(copy == original);
+
+    DequeLite<int> moved(std::move(copy));
+    EXPECT_TRUE(moved == original);
+
+    int expected = 0;
+    for (const auto& value : moved) {
+        EXPECT_EQ(value, expected);
+        expected++;
+    }
+}
+
+TEST(Deque, MovedFrom_IsEmptyAndReusable) {
+    DequeLite<int> source({1, 2, 3});
+    DequeLite<int> moved(std::move(source));
+    EXPECT_EQ(moved.size(), 3);
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(source.capacity(), 0); // the move steals storage, it never allocates
+
+    source.push_front(5);
+    source.push_back(6);
+    EXPECT_TRUE(source == DequeLite<int>({5, 6}));
+
+    DequeLite<int> bounded(2, DequeOverflow::OverwriteOldest);
+    DequeLite<int> taken(std::move(bounded));
+    bounded.push_back(7);
+    EXPECT_EQ(bounded.front(), 7);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "VectorLiteExpr.h"
+#include <stdexcept>
+
+TEST(Expr, FusedArithmetic_MatchesElementwiseLoop) {
+    VectorLite<double> b({1.0, 2.0, 3.0, 4.0});
+    VectorLite<double> c({0.5, 0.5, 2.0, 2.0});
+    VectorLite<double> d({10.0, 20.0, 30.0, 40.0});
+
+    VectorLite<double> a = b * c + d;
+    EXPECT_TRUE(a == VectorLite<double>({10.5, 21.0, 36.0, 48.0}));
+
+    a = (d - b) / c;
+    EXPECT_TRUE(a == VectorLite<double>({18.0, 36.0, 13.5, 18.0}));
+
+    a = -b;
+    EXPECT_DOUBLE_EQ(a[3], -4.0);
+}
+
+TEST(Expr, ScalarBroadcast_EitherSide) {
+    VectorLite<double> v({1.0, 2.0, 3.0});
+    VectorLite<double> scaled = 2.0 * v + 1.0;
+    EXPECT_TRUE(scaled == VectorLite<double>({3.0, 5.0, 7.0}));
+
+    VectorLite<double> inverted = 1.0 / v;
+    EXPECT_DOUBLE_EQ(inverted[1], 0.5);
+
+    VectorLite<int> ints({1, 2, 3});
+    VectorLite<double> promoted = ints * 0.5;
+    EXPECT_DOUBLE_EQ(promoted[0], 0.5);
+}
+
+TEST(Expr, Assignment_ReusesBufferAndAllowsAliasing) {
+    VectorLite<double> a({1.0, 2.0, 3.0, 4.0});
+    VectorLite<double> b({2.0, 2.0, 2.0, 2.0});
+    const double* before = a.data();
+
+    a = a * b + a;
+    EXPECT_EQ(a.data(), before);
+    EXPECT_TRUE(a == VectorLite<double>({3.0, 6.0, 9.0, 12.0}));
+}
+
+TEST(Expr, Assignment_GrowsWhenTooSmall) {
+    VectorLite<float> small(1, VectorLiteAllocOptions::cache_aligned());
+    VectorLite<float> x({1.0f, 2.0f, 3.0f, 4.0f, 5.0f});
+    small = x + x;
+    EXPECT_EQ(small.size(), 5);
+    EXPECT_FLOAT_EQ(small[4], 10.0f);
+    EXPECT_EQ(small.alloc_options().alignment, 64);
+}
+
+TEST(Expr, SizeMismatch_Throws) {
+    VectorLite<double> a({1.0, 2.0});
+    VectorLite<double> b({1.0, 2.0, 3.0});
+    EXPECT_THROW(a + b, std::invalid_argument);
+}
+
+/* A user's own unqualified helper must not collide with the reductions */
+template <typename T>
+static size_t count(const T&)
+{
+    return 42;
+}
+
+TEST(Expr, NamedFunctions_StayOutOfTheGlobalNamespace) {
+    VectorLite<int> v({1, 2, 3});
+    EXPECT_EQ(count(v), 42);
+    EXPECT_EQ(vlexpr::count(v), 3);
+}
+
+TEST(Expr, Comparisons_ProduceMasks) {
+    VectorLite<int> v({5, 1, 7, 3});
+    VectorLite<bool> mask = v > 4;
+    EXPECT_TRUE(mask == VectorLite<bool>({true, false, true, false}));
+    EXPECT_EQ(vlexpr::count(v <= 3), 2);
+    EXPECT_EQ(vlexpr::count(vlexpr::eq(v, 7)), 1);
+    EXPECT_EQ(vlexpr::count(vlexpr::ne(v, v)), 0);
+    EXPECT_TRUE(vlexpr::any(v < 2));
+    EXPECT_FALSE(vlexpr::all(v >= 2));
+    EXPECT_TRUE(vlexpr::all(v * 2 >= v));
+}
+
+TEST(Expr, Reductions_OverVectorsAndExpressions) {
+    VectorLite<double> a({1.0, 2.0, 3.0, 4.0, 5.0});
+    VectorLite<double> b({2.0, 2.0, 2.0, 2.0, 2.0});
+    EXPECT_DOUBLE_EQ(vlexpr::sum(a), 15.0);
+    EXPECT_DOUBLE_EQ(vlexpr::sum(a * b + 1.0), 35.0);
+    EXPECT_DOUBLE_EQ(vlexpr::dot(a, b), 30.0);
+    EXPECT_DOUBLE_EQ(vlexpr::minimum(a - 3.0), -2.0);
+    EXPECT_DOUBLE_EQ(vlexpr::maximum(-a), -1.0);
+
+    VectorLite<int> ints({1, 2, 3});
+    EXPECT_EQ(vlexpr::sum(ints), 6);
+    EXPECT_EQ(vlexpr::sum(VectorLite<int>()), 0);
+    EXPECT_THROW(vlexpr::minimum(VectorLite<double>()), std::invalid_argument);
+}
+
+TEST(Expr, Eval_MaterializesExpression) {
+    VectorLite<int> v({1, 2, 3});
+    VectorLite<int> squared = (v * v).eval();
+    EXPECT_TRUE(squared == VectorLite<int>({1, 4, 9}));
+    EXPECT_EQ((v + 1)[2], 4);
+    EXPECT_EQ((v + 1).size(), 3);
+}
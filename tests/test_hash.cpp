@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include "VectorLiteHash.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+TEST(Hash, EqualVectors_HashEqual) {
+    std::hash<VectorLite<int>> hasher;
+    VectorLite<int> a({1, 2, 3, 4, 5});
+    VectorLite<int> b(100);
+    for (int i = 1; i <= 5; ++i) {
+        b.push_back(i);
+    }
+    EXPECT_EQ(hasher(a), hasher(b)); // capacity does not matter
+
+    VectorLite<std::string> s1({"to", "be"});
+    VectorLite<std::string> s2({"to", "be"});
+    EXPECT_EQ(std::hash<VectorLite<std::string>>{}(s1), std::hash<VectorLite<std::string>>{}(s2));
+}
+
+TEST(Hash, DifferentContentOrLength_HashDiffers) {
+    std::hash<VectorLite<uint8_t>> hasher;
+    VectorLite<uint8_t> empty;
+    VectorLite<uint8_t> zero({0});
+    VectorLite<uint8_t> zeros({0, 0});
+    EXPECT_NE(hasher(empty), hasher(zero));
+    EXPECT_NE(hasher(zero), hasher(zeros));
+
+    // every length crosses a different branch of the byte hash
+    std::unordered_set<size_t> seen;
+    VectorLite<uint8_t> bytes;
+    for (int len = 0; len < 200; ++len) {
+        EXPECT_TRUE(seen.insert(hasher(bytes)).second) << "collision at length " << len;
+        bytes.push_back(static_cast<uint8_t>(len * 31));
+    }
+}
+
+TEST(Hash, SingleBitFlip_ChangesHash) {
+    std::hash<VectorLite<uint64_t>> hasher;
+    VectorLite<uint64_t> v;
+    for (uint64_t i = 0; i < 20; ++i) {
+        v.push_back(i * 0x0101010101010101ull);
+    }
+    size_t base = hasher(v);
+    for (size_t word = 0; word < v.size(); ++word) {
+        v[word] ^= 1ull << (word % 64);
+        EXPECT_NE(hasher(v), base);
+        v[word] ^= 1ull << (word % 64);
+    }
+    EXPECT_EQ(hasher(v), base);
+}
+
+TEST(Hash, FloatingPoint_ZeroSignsHashAlike) {
+    std::hash<VectorLite<double>> hasher;
+    EXPECT_EQ(hasher(VectorLite<double>({0.0, 1.0})), hasher(VectorLite<double>({-0.0, 1.0})));
+}
+
+TEST(Hash, WorksAsUnorderedMapKey) {
+    std::unordered_map<VectorLite<int>, int> counts;
+    counts[VectorLite<int>({1, 2})]++;
+    counts[VectorLite<int>({1, 2})]++;
+    counts[VectorLite<int>({2, 1})]++;
+    EXPECT_EQ(counts.size(), 2);
+    EXPECT_EQ((counts[VectorLite<int>({1, 2})]), 2);
+}
+
+TEST(Hash, HashCombine_IsOrderSensitive) {
+    size_t ab = 0, ba = 0;
+    vlhash::hash_combine(ab, 1);
+    vlhash::hash_combine(ab, 2);
+    vlhash::hash_combine(ba, 2);
+    vlhash::hash_combine(ba, 1);
+    EXPECT_NE(ab, ba);
+}
+
+TEST(Hash, PortableMultiply_MatchesTheWideProduct) {
+    const uint64_t values[] = {0, 1, 0xffffffffull, 0x100000000ull, 0xffffffffffffffffull,
+                               0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x123456789abcdef0ull};
+    for (uint64_t a : values) {
+        for (uint64_t b : values) {
+            uint64_t lo = 0, hi = 0;
+            hash_detail::multiply_128_portable(a, b, lo, hi);
+#ifdef __SIZEOF_INT128__
+            const __uint128_t product = static_cast<__uint128_t>(a) * b;
+            EXPECT_EQ(lo, static_cast<uint64_t>(product));
+            EXPECT_EQ(hi, static_cast<uint64_t>(product >> 64));
+#endif
+            uint64_t fastLo = 0, fastHi = 0;
+            hash_detail::multiply_128(a, b, fastLo, fastHi);
+            EXPECT_EQ(lo, fastLo);
+            EXPECT_EQ(hi, fastHi);
+        }
+    }
+}
+
+TEST(Dedup, KeepsFirstOccurrenceInOrder) {
+    VectorLite<int> v({5, 3, 5, 1, 3, 3, 9, 1});
+    EXPECT_EQ(vlhash::dedup(v), 4);
+    EXPECT_TRUE(v == VectorLite<int>({5, 3, 1, 9}));
+    EXPECT_EQ(vlhash::dedup(v), 0);
+}
+
+TEST(Dedup, LargeInput_MatchesSetSemantics) {
+    VectorLite<uint32_t> v;
+    for (uint32_t i = 0; i < 100000; ++i) {
+        v.push_back((i * 7919u) % 1000u);
+    }
+    EXPECT_EQ(vlhash::dedup(v), 99000);
+    ASSERT_EQ(v.size(), 1000);
+    std::unordered_set<uint32_t> distinct(v.begin(), v.end());
+    EXPECT_EQ(distinct.size(), 1000);
+    EXPECT_EQ(v[0], 0u);
+    EXPECT_EQ(v[1], 919u);
+}
+
+TEST(Dedup, Strings_AndCustomEquality) {
+    VectorLite<std::string> words({"a", "b", "a", "c", "b"});
+    vlhash::dedup(words);
+    EXPECT_TRUE(words == VectorLite<std::string>({"a", "b", "c"}));
+
+    VectorLite<int> v({1, 11, 2, 21, 3});
+    auto lastDigit = [](int x) { return std::hash<int>{}(x % 10); };
+    auto sameDigit = [](int x, int y) { return x % 10 == y % 10; };
+    vlhash::dedup(v, lastDigit, sameDigit);
+    EXPECT_TRUE(v == VectorLite<int>({1, 2, 3}));
+}
+
+TEST(Dedup, Unique_LeavesSourceAlone) {
+    const VectorLite<int> v({4, 4, 2, 4, 2});
+    VectorLite<int> u = vlhash::unique(v);
+    EXPECT_TRUE(u == VectorLite<int>({4, 2}));
+    EXPECT_EQ(v.size(), 5);
+    EXPECT_TRUE(vlhash::unique(VectorLite<int>()).empty());
+}
+
+/* A user's own unqualified helper must not collide with vlhash::unique */
+template <typename T>
+static size_t unique(const VectorLite<T>&)
+{
+    return 42;
+}
+
+TEST(Dedup, StaysOutOfTheGlobalNamespace) {
+    VectorLite<int> v({3, 3, 1});
+    EXPECT_EQ(unique(v), 42);
+    EXPECT_TRUE(vlhash::unique(v) == VectorLite<int>({3, 1}));
+}
+
+TEST(BatchHash, MatchesStdHashPerRow) {
+    VectorLite<VectorLite<int>> rows;
+    for (int r = 0; r < 5000; ++r) {
+        VectorLite<int> row;
+        for (int i = 0; i < r % 17; ++i) {
+            row.push_back(r * i);
+        }
+        rows.push_back(row);
+    }
+    std::hash<VectorLite<int>> hasher;
+    for (unsigned threads : {1u, 3u, 0u}) {
+        VectorLite<size_t> hashes = vlhash::batch_hash(rows, threads);
+        ASSERT_EQ(hashes.size(), rows.size());
+        for (size_t r = 0; r < rows.size(); ++r) {
+            ASSERT_EQ(hashes[r], hasher(rows[r]));
+        }
+    }
+}
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include "VectorLiteLoader.h"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unistd.h>
+
+static std::string temp_path(const std::string& name)
+{
+    return ::testing::TempDir() + "vectorlite_" + std::to_string(::getpid()) + "_" + name;
+}
+
+static std::string write_file(const std::string& name, const std::string& contents)
+{
+    std::string path = temp_path(name);
+    std::ofstream out(path, std::ios::binary);
+    out << contents;
+    return path;
+}
+
+static LoaderOptions small_chunks(LoaderBackend backend)
+{
+    LoaderOptions opts;
+    opts.chunkBytes = 4096; // the minimum, so lines straddle chunk and batch boundaries
+    opts.threads = 3;
+    opts.backend = backend;
+    return opts;
+}
+
+static bool io_uring_usable()
+{
+    try {
+        VectorLiteLoader loader(small_chunks(LoaderBackend::IoUring));
+        return true;
+    } catch (const std::system_error&) {
+        return false;
+    }
+}
+
+class LoaderBackends : public ::testing::TestWithParam<LoaderBackend> {
+protected:
+    void SetUp() override {
+        if (GetParam() == LoaderBackend::IoUring && !io_uring_usable()) {
+            GTEST_SKIP() << "io_uring is not available here";
+        }
+    }
+};
+
+TEST_P(LoaderBackends, Lines_SpanningChunksAndBatches) {
+    std::string text;
+    for (int64_t i = 0; i < 50000; ++i) {
+        text += std::to_string(i * 7919 - 100000) + "\n";
+    }
+    std::string path = write_file("ints.txt", text);
+
+    VectorLiteLoader loader(small_chunks(GetParam()));
+    VectorLite<int64_t> values;
+    LoaderStats stats = loader.load_lines(values, path);
+    std::remove(path.c_str());
+
+    if (GetParam() == LoaderBackend::Auto) {
+        EXPECT_NE(stats.backend, LoaderBackend::Auto); // reports what actually ran
+    } else {
+        EXPECT_EQ(stats.backend, GetParam());
+    }
+    EXPECT_EQ(stats.bytes, text.size());
+    EXPECT_EQ(stats.records, 50000);
+    EXPECT_GT(stats.batches, 1);
+    ASSERT_EQ(values.size(), 50000);
+    for (int64_t i = 0; i < 50000; ++i) {
+        ASSERT_EQ(values[i], i * 7919 - 100000);
+    }
+}
+
+TEST_P(LoaderBackends, Binary_ReadsStraightIntoTarget) {
+    std::string bytes;
+    for (float i = 0; i < 30000; i += 1.0f) {
+        float value = i * 0.5f;
+        bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    std::string path = write_file("floats.bin", bytes);
+
+    VectorLiteLoader loader(small_chunks(GetParam()));
+    VectorLite<float> values({-1.0f});
+    LoaderStats stats = loader.load_binary(values, path);
+    std::remove(path.c_str());
+
+    EXPECT_EQ(stats.records, 30000);
+    ASSERT_EQ(values.size(), 30001);
+    EXPECT_FLOAT_EQ(values[0], -1.0f);
+    EXPECT_FLOAT_EQ(values[1], 0.0f);
+    EXPECT_FLOAT_EQ(values[30000], 29999 * 0.5f);
+}
+
+INSTANTIATE_TEST_SUITE_P(Loader, LoaderBackends,
+                         ::testing::Values(LoaderBackend::Pread, LoaderBackend::IoUring, LoaderBackend::Auto));
+
+TEST(Loader, Lines_CrLfBlankLinesAndNoTrailingNewline) {
+    std::string path = write_file("mixed.txt", "1.5\r\n\n  -2.25 \n\r\n3e2");
+    VectorLiteLoader loader;
+    VectorLite<double> values;
+    loader.load_lines(values, path);
+    std::remove(path.c_str());
+    EXPECT_TRUE(values == VectorLite<double>({1.5, -2.25, 300.0}));
+}
+
+TEST(Loader, Lines_CustomParserAndAppend) {
+    std::string path = write_file("words.txt", "alpha\nbeta\ngamma\n");
+    VectorLiteLoader loader(small_chunks(LoaderBackend::Auto));
+    VectorLite<std::string> words({"start"});
+    loader.load_lines(words, path, [](const char* begin, const char* end) {
+        return std::string(begin, end);
+    });
+    std::remove(path.c_str());
+    EXPECT_TRUE(words == VectorLite<std::string>({"start", "alpha", "beta", "gamma"}));
+}
+
+TEST(Loader, EmptyFile_LeavesTargetAlone) {
+    std::string path = write_file("empty.txt", "");
+    VectorLiteLoader loader;
+    VectorLite<int> values({1});
+    LoaderStats stats = loader.load_lines(values, path);
+    loader.load_binary(values, path);
+    std::remove(path.c_str());
+    EXPECT_EQ(stats.records, 0);
+    EXPECT_EQ(values.size(), 1);
+}
+
+TEST(Loader, Errors_AreReported) {
+    VectorLiteLoader loader(small_chunks(LoaderBackend::Auto));
+    VectorLite<int> values;
+    EXPECT_THROW(loader.load_lines(values, temp_path("missing.txt")), std::system_error);
+
+    std::string bad = write_file("bad.txt", "1\n2\nthree\n4\n");
+    EXPECT_THROW(loader.load_lines(values, bad), std::runtime_error);
+    std::remove(bad.c_str());
+
+    std::string longLine = write_file("long.txt", "1\n" + std::string(20000, '7') + "\n2\n");
+    EXPECT_THROW(loader.load_lines(values, longLine), std::runtime_error);
+    std::remove(longLine.c_str());
+
+    std::string odd = write_file("odd.bin", "12345");
+    EXPECT_THROW(loader.load_binary(values, odd), std::runtime_error);
+    std::remove(odd.c_str());
+
+    // the loader stays usable after a failure
+    std::string good = write_file("good.txt", "5\n6\n");
+    VectorLite<int> fresh;
+    loader.load_lines(fresh, good);
+    std::remove(good.c_str());
+    EXPECT_TRUE(fresh == VectorLite<int>({5, 6}));
+}
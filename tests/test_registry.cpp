@@ -0,0 +1,243 @@
+#include <gtest/gtest.h>
+#include "VectorLiteRegistry.h"
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <unistd.h>
+
+static VectorLiteRegistry& registry()
+{
+    return VectorLiteRegistry::instance();
+}
+
+static const VectorLiteUsage* find_group(const VectorLiteReport& report, const std::string& tag)
+{
+    for (const VectorLiteUsage& group : report.groups) {
+        if (group.tag == tag) {
+            return &group;
+        }
+    }
+    return nullptr;
+}
+
+TEST(Registry, TrackingIsOptInAndEndsWithTheVector) {
+    const size_t before = registry().tracked_count();
+    VectorLite<int> plain;
+    EXPECT_FALSE(plain.tracked());
+    {
+        VectorLite<int> vec;
+        vec.track("scoped");
+        EXPECT_TRUE(vec.tracked());
+        EXPECT_EQ(registry().tracked_count(), before + 1);
+    }
+    EXPECT_EQ(registry().tracked_count(), before);
+
+    VectorLite<int> vec;
+    vec.track("untracked by hand");
+    vec.untrack();
+    EXPECT_FALSE(vec.tracked());
+    EXPECT_EQ(registry().tracked_count(), before);
+}
+
+TEST(Registry, Report_SizesCapacitiesAndSlack) {
+    VectorLite<int32_t> ids(100);
+    for (int32_t i = 0; i < 10; ++i) {
+        ids.push_back(i);
+    }
+    ids.track("report.ids");
+
+    VectorLite<double> a(8), b(8);
+    a.push_back(1.0);
+    a.track("report.doubles");
+    b.track("report.doubles");
+
+    VectorLiteReport report = registry().report();
+    const VectorLiteUsage* idGroup = find_group(report, "report.ids");
+    ASSERT_NE(idGroup, nullptr);
+    EXPECT_EQ(idGroup->type, "VectorLite<int>");
+    EXPECT_EQ(idGroup->vectors, 1);
+    EXPECT_EQ(idGroup->liveBytes, 40);
+    EXPECT_EQ(idGroup->capacityBytes, 400);
+    EXPECT_EQ(idGroup->slackBytes, 360);
+
+    const VectorLiteUsage* doubleGroup = find_group(report, "report.doubles");
+    ASSERT_NE(doubleGroup, nullptr);
+    EXPECT_EQ(doubleGroup->vectors, 2);
+    EXPECT_EQ(doubleGroup->liveBytes, 8);
+    EXPECT_EQ(doubleGroup->capacityBytes, 128);
+
+    // largest slack first, and the total adds every group up
+    EXPECT_EQ(report.groups[0].tag, "report.ids");
+    EXPECT_EQ(report.total.vectors, 3);
+    EXPECT_EQ(report.total.slackBytes, 360 + 120);
+
+    // 400 bytes lands in [256, 512), both 64-byte buffers in [64, 128)
+    EXPECT_EQ(report.capacityHistogram[9], 1);
+    EXPECT_EQ(report.capacityHistogram[7], 2);
+}
+
+TEST(Registry, TrackingFollowsTheObjectNotTheBuffer) {
+    VectorLite<int> tracked(64);
+    tracked.track("follow");
+    VectorLite<int> other({1, 2, 3});
+
+    swap(tracked, other);
+    EXPECT_TRUE(tracked.tracked());
+    EXPECT_FALSE(other.tracked());
+    EXPECT_EQ(find_group(registry().report(), "follow")->liveBytes, 3 * sizeof(int));
+
+    for (int i = 0; i < 1000; ++i) {
+        tracked.push_back(i); // growth swaps with a temporary internally
+    }
+    EXPECT_TRUE(tracked.tracked());
+    EXPECT_EQ(find_group(registry().report(), "follow")->liveBytes, 1003 * sizeof(int));
+
+    VectorLite<int> copy = tracked;
+    VectorLite<int> moved = std::move(tracked);
+    EXPECT_FALSE(copy.tracked());
+    EXPECT_TRUE(moved.tracked());
+    EXPECT_FALSE(tracked.tracked());
+    EXPECT_EQ(find_group(registry().report(), "follow")->vectors, 1);
+    EXPECT_EQ(find_group(registry().report(), "follow")->liveBytes, 1003 * sizeof(int));
+
+    VectorLite<int> assigned({7});
+    assigned.track("follow.assigned");
+    assigned = std::move(moved); // the entries trade places along with the contents
+    EXPECT_TRUE(assigned.tracked());
+    EXPECT_TRUE(moved.tracked());
+    EXPECT_EQ(find_group(registry().report(), "follow")->liveBytes, 1003 * sizeof(int));
+    EXPECT_EQ(find_group(registry().report(), "follow.assigned")->liveBytes, sizeof(int));
+
+    assigned.track("follow.renamed");
+    VectorLiteReport report = registry().report();
+    EXPECT_EQ(find_group(report, "follow"), nullptr);
+    EXPECT_NE(find_group(report, "follow.renamed"), nullptr);
+}
+
+TEST(Registry, ShrinkToFit) {
+    VectorLite<std::string> words(50);
+    words.push_back("alpha");
+    words.push_back("beta");
+    words.shrink_to_fit();
+    EXPECT_EQ(words.capacity(), 2);
+    EXPECT_TRUE(words == VectorLite<std::string>({"alpha", "beta"}));
+
+    VectorLite<int> empty(16, VectorLiteAllocOptions::cache_aligned());
+    empty.shrink_to_fit();
+    EXPECT_EQ(empty.capacity(), 1);
+    EXPECT_EQ(empty.alloc_options().alignment, 64);
+    empty.push_back(5);
+    EXPECT_EQ(empty[0], 5);
+}
+
+TEST(Registry, ShrinkAllOver_OnlyTouchesLargeSlack) {
+    VectorLite<int64_t> big(10000);
+    big.push_back(1);
+    big.track("shrink.big");
+
+    VectorLite<int64_t> small(16);
+    small.push_back(2);
+    small.track("shrink.small");
+
+    VectorLite<int64_t> untracked(10000);
+
+    const size_t released = registry().shrink_all_over(1024);
+    EXPECT_GE(released, 9999 * sizeof(int64_t));
+    EXPECT_EQ(big.capacity(), 1);
+    EXPECT_EQ(big[0], 1);
+    EXPECT_EQ(small.capacity(), 16);
+    EXPECT_EQ(untracked.capacity(), 10000);
+}
+
+TEST(Registry, ShrinkAllOver_TrackedElementsInsideTrackedVectors) {
+    VectorLite<VectorLite<int>> outer(32);
+    outer.track("nested.outer");
+    for (int i = 0; i < 3; ++i) {
+        outer.push_back(VectorLite<int>({i}));
+        outer[i].track("nested.inner"); // moved into the new slots by the shrink, entry and all
+    }
+    registry().shrink_all_over(0);
+    EXPECT_EQ(outer.capacity(), 3);
+    EXPECT_EQ(outer[2][0], 2);
+    EXPECT_TRUE(outer[2].tracked());
+
+    VectorLiteReport report = registry().report();
+    const VectorLiteUsage* inner = find_group(report, "nested.inner");
+    ASSERT_NE(inner, nullptr);
+    EXPECT_EQ(inner->vectors, 3);
+    EXPECT_EQ(inner->liveBytes, 3 * sizeof(int));
+}
+
+/* Reports read only what the vectors published, so they may run while the owner keeps working */
+TEST(Registry, Report_WhileTheOwnerThreadMutates) {
+    std::atomic<bool> done { false };
+    std::thread owner([&done] {
+        VectorLite<uint64_t> vec;
+        vec.track("concurrent.owner");
+        for (int round = 0; round < 20; ++round) {
+            for (uint64_t i = 0; i < 20000; ++i) {
+                vec.push_back(i);
+            }
+            VectorLite<uint64_t> moved(std::move(vec)); // the entry follows, without a lock
+            vec = std::move(moved);
+            vec.clear();
+        }
+        done = true;
+    });
+
+    size_t reports = 0;
+    while (!done) {
+        VectorLiteReport report = registry().report();
+        const VectorLiteUsage* group = find_group(report, "concurrent.owner");
+        if (group != nullptr) {
+            EXPECT_LE(group->liveBytes, group->capacityBytes);
+        }
+        ++reports;
+    }
+    owner.join();
+    EXPECT_GT(reports, 0);
+    EXPECT_EQ(find_group(registry().report(), "concurrent.owner"), nullptr);
+}
+
+TEST(Registry, Json_EscapesTagsAndListsHistogram) {
+    VectorLite<char> text(4);
+    text.track("quote\" back\\slash\nnewline");
+    std::string json = registry().to_json();
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+    EXPECT_NE(json.find("\"total\":{\"vectors\":"), std::string::npos);
+    EXPECT_NE(json.find("\"tag\":\"quote\\\" back\\\\slash\\u000anewline\""), std::string::npos);
+    EXPECT_NE(json.find("{\"min_bytes\":4,\"max_bytes\":7,\"vectors\":"), std::string::npos);
+}
+
+TEST(Registry, SignalDump_WritesReportToFile) {
+    const std::string path = ::testing::TempDir() + "vectorlite_" + std::to_string(::getpid()) + "_registry.json";
+    std::remove(path.c_str());
+
+    VectorLite<int> vec(32);
+    vec.track("signal.dump");
+    registry().install_signal_dump(SIGUSR2, path);
+    EXPECT_THROW(registry().install_signal_dump(SIGUSR2, path), std::logic_error);
+    std::raise(SIGUSR2);
+
+    std::string contents;
+    for (int i = 0; i < 200 && contents.empty(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        std::ifstream in(path);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        contents = buffer.str();
+    }
+    registry().remove_signal_dump();
+    registry().remove_signal_dump(); // no-op once removed
+    std::remove(path.c_str());
+
+    EXPECT_NE(contents.find("\"tag\":\"signal.dump\""), std::string::npos);
+}
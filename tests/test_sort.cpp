@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include "VectorLiteSort.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+
+template <typename T>
+static bool sorted_like_std(VectorLite<T> vec, RadixDigits digits)
+{
+    VectorLite<T> expected = vec;
+    std::sort(expected.data(), expected.data() + expected.size());
+    radix_sort(vec, digits);
+    return vec == expected;
+}
+
+static VectorLite<int64_t> random_signed(size_t n, uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    VectorLite<int64_t> vec(n);
+    for (size_t i = 0; i < n; ++i) {
+        vec.push_back(static_cast<int64_t>(rng()));
+    }
+    return vec;
+}
+
+TEST(Sort, Unsigned_AllDigitWidths) {
+    std::mt19937 rng(1);
+    VectorLite<uint32_t> vec;
+    for (int i = 0; i < 5000; ++i) {
+        vec.push_back(rng());
+    }
+    for (RadixDigits digits : {RadixDigits::Auto, RadixDigits::Bits8, RadixDigits::Bits11, RadixDigits::Bits16}) {
+        EXPECT_TRUE(sorted_like_std(vec, digits));
+    }
+}
+
+TEST(Sort, Signed_NegativesBeforePositives) {
+    VectorLite<int64_t> vec = random_signed(3000, 2);
+    vec.push_back(std::numeric_limits<int64_t>::min());
+    vec.push_back(std::numeric_limits<int64_t>::max());
+    vec.push_back(0);
+    vec.push_back(-1);
+    for (RadixDigits digits : {RadixDigits::Bits8, RadixDigits::Bits11, RadixDigits::Bits16}) {
+        EXPECT_TRUE(sorted_like_std(vec, digits));
+    }
+
+    VectorLite<int8_t> small({5, -128, 127, 0, -1, 3});
+    radix_sort(small);
+    EXPECT_TRUE(small == VectorLite<int8_t>({-128, -1, 0, 3, 5, 127}));
+}
+
+TEST(Sort, Floats_IncludingInfinitiesAndSignedZero) {
+    const float inf = std::numeric_limits<float>::infinity();
+    VectorLite<float> vec({3.5f, -0.0f, -inf, 1e-30f, -2.25f, inf, 0.0f, -1e30f, 7.0f});
+    radix_sort(vec);
+    EXPECT_TRUE(vec == VectorLite<float>({-inf, -1e30f, -2.25f, -0.0f, 0.0f, 1e-30f, 3.5f, 7.0f, inf}));
+    EXPECT_TRUE(std::signbit(vec[3]));
+    EXPECT_FALSE(std::signbit(vec[4]));
+
+    std::mt19937_64 rng(3);
+    std::normal_distribution<double> dist(0.0, 1e6);
+    VectorLite<double> doubles;
+    for (int i = 0; i < 4000; ++i) {
+        doubles.push_back(dist(rng));
+    }
+    EXPECT_TRUE(sorted_like_std(doubles, RadixDigits::Bits11));
+}
+
+TEST(Sort, ByKey_IsStable) {
+    std::mt19937 rng(4);
+    VectorLite<std::pair<int16_t, int>> pairs;
+    for (int i = 0; i < 10000; ++i) {
+        pairs.push_back({static_cast<int16_t>(static_cast<int>(rng() % 64) - 32), i});
+    }
+    VectorLite<std::pair<int16_t, int>> expected = pairs;
+    std::stable_sort(expected.data(), expected.data() + expected.size(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    radix_sort_by_key(pairs, [](const std::pair<int16_t, int>& p) { return p.first; });
+    EXPECT_TRUE(pairs == expected);
+}
+
+TEST(Sort, LeavesCapacityAndBufferAlone) {
+    VectorLite<uint32_t> vec(8, VectorLiteAllocOptions::cache_aligned());
+    for (uint32_t i = 1000; i > 0; --i) {
+        vec.push_back(i);
+    }
+    const size_t capacity = vec.capacity();
+    const uint32_t* buffer = vec.data();
+    radix_sort(vec);
+    EXPECT_EQ(vec.size(), 1000);
+    EXPECT_EQ(vec.capacity(), capacity);
+    EXPECT_EQ(vec.data(), buffer);
+    EXPECT_EQ(vec.alloc_options().alignment, 64);
+    EXPECT_EQ(vec[0], 1u);
+    EXPECT_EQ(vec[999], 1000u);
+}
+
+TEST(Sort, TrivialInputs) {
+    VectorLite<int> empty;
+    radix_sort(empty);
+    EXPECT_TRUE(empty.empty());
+
+    VectorLite<int> one({42});
+    radix_sort(one);
+    EXPECT_EQ(one[0], 42);
+
+    VectorLite<uint64_t> same;
+    for (int i = 0; i < 100; ++i) {
+        same.push_back(7);
+    }
+    radix_sort(same); // every pass is skipped
+    EXPECT_TRUE(std::all_of(same.begin(), same.end(), [](uint64_t v) { return v == 7; }));
+}
+
+TEST(Sort, Parallel_MatchesSequential) {
+    VectorLite<int64_t> vec = random_signed(300000, 5);
+    VectorLite<int64_t> expected = vec;
+    radix_sort(expected);
+    for (unsigned threads : {2u, 3u, 0u}) {
+        VectorLite<int64_t> copy = vec;
+        parallel_radix_sort(copy, threads);
+        EXPECT_TRUE(copy == expected);
+    }
+    VectorLite<int64_t> copy = vec;
+    const size_t capacity = copy.capacity();
+    parallel_radix_sort(copy, 4, RadixDigits::Bits16);
+    EXPECT_TRUE(copy == expected);
+    EXPECT_EQ(copy.capacity(), capacity);
+}
+
+TEST(Sort, ParallelByKey_IsStable) {
+    std::mt19937 rng(6);
+    VectorLite<std::pair<float, uint32_t>> pairs;
+    for (uint32_t i = 0; i < 200000; ++i) {
+        pairs.push_back({static_cast<float>(rng() % 1000) - 500.0f, i});
+    }
+    VectorLite<std::pair<float, uint32_t>> expected = pairs;
+    std::stable_sort(expected.data(), expected.data() + expected.size(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    parallel_radix_sort_by_key(pairs, [](const std::pair<float, uint32_t>& p) { return p.first; }, 3);
+    EXPECT_TRUE(pairs == expected);
+}
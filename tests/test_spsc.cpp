@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "SpscRingLite.h"
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(Spsc, Capacity_RoundsUpToPowerOfTwo) {
+    SpscRingLite<int> ring(5);
+    EXPECT_EQ(ring.capacity(), 8);
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(Spsc, Capacity_RejectsSizesWithNoPowerOfTwo) {
+    const size_t tooBig = (std::numeric_limits<size_t>::max() >> 1) + 2;
+    EXPECT_THROW(SpscRingLite<int> ring(tooBig), std::length_error);
+}
+
+TEST(Spsc, TryPushTryPop_SingleThreadFifo) {
+    SpscRingLite<std::string> ring(4);
+    EXPECT_TRUE(ring.try_push("a"));
+    EXPECT_TRUE(ring.try_push("b"));
+    EXPECT_TRUE(ring.try_push("c"));
+    EXPECT_TRUE(ring.try_push("d"));
+    EXPECT_FALSE(ring.try_push("e"));
+    EXPECT_EQ(ring.size(), 4);
+
+    std::string out;
+    EXPECT_TRUE(ring.try_pop(out));
+    EXPECT_EQ(out, "a");
+    EXPECT_TRUE(ring.try_push("e"));
+
+    const char* expected[] = {"b", "c", "d", "e"};
+    for (const char* value : expected) {
+        EXPECT_TRUE(ring.try_pop(out));
+        EXPECT_EQ(out, value);
+    }
+    EXPECT_FALSE(ring.try_pop(out));
+}
+
+TEST(Spsc, BatchOps_WrapAroundStorage) {
+    SpscRingLite<int> ring(8);
+    int in[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    int out[8] = {};
+
+    EXPECT_EQ(ring.try_push_n(in, 5), 5);
+    EXPECT_EQ(ring.try_pop_n(out, 5), 5);
+    // tail is now at slot 5, the next batch wraps
+    EXPECT_EQ(ring.try_push_n(in, 8), 8);
+    EXPECT_EQ(ring.try_push_n(in, 1), 0);
+    EXPECT_EQ(ring.try_pop_n(out, 8), 8);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(out[i], i);
+    }
+}
+
+/* Meant to be run under ThreadSanitizer: configure with -DVECTORLITE_TSAN=ON */
+static void run_stress(SpscWaitMode mode)
+{
+    constexpr uint64_t items = 200'000;
+    SpscRingLite<uint64_t> ring(64, mode);
+
+    std::thread producer([&ring] {
+        std::vector<uint64_t> batch;
+        uint64_t next = 0;
+        while (next < items) {
+            size_t len = static_cast<size_t>(next % 37) + 1;
+            if (next % 3 == 0) {
+                ring.push(next++);
+                continue;
+            }
+            batch.clear();
+            for (size_t i = 0; i < len && next < items; ++i) {
+                batch.push_back(next++);
+            }
+            ring.push_n(batch.data(), batch.size());
+        }
+    });
+
+    uint64_t expected = 0;
+    bool inOrder = true;
+    uint64_t buffer[29];
+    while (expected < items) {
+        if (expected % 5 == 0) {
+            inOrder &= ring.pop() == expected++;
+            continue;
+        }
+        size_t got = ring.pop_n(buffer, 29);
+        for (size_t i = 0; i < got; ++i) {
+            inOrder &= buffer[i] == expected++;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(inOrder);
+    EXPECT_EQ(expected, items);
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(Spsc, Stress_SpinThenPark) {
+    run_stress(SpscWaitMode::SpinThenPark);
+}
+
+TEST(Spsc, Stress_NonBlocking) {
+    run_stress(SpscWaitMode::NonBlocking);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "Vector.h"
 #include <stdexcept>
+#include <utility>
 
 TEST(Utilities, Reserve)
 {
@@ -44,4 +45,31 @@ TEST(Utilities, EmptyAfterClear)
     VectorLite<int> myVec({1, 2, 3, 4, 5});
     myVec.clear();
     EXPECT_TRUE(myVec.empty() == 1);
-}
\ No newline at end of file
+}
+
+TEST(Utilities, CapacityIsZeroAfterClear)
+{
+    VectorLite<int> myVec({1, 2, 3});
+    myVec.clear();
+    EXPECT_EQ(myVec.capacity(), 0);
+    EXPECT_EQ(myVec.data(), nullptr);
+}
+
+TEST(Utilities, PushBackAfterClear)
+{
+    VectorLite<int> myVec({1, 2, 3});
+    myVec.clear();
+    myVec.push_back(4);
+    EXPECT_EQ(myVec.size(), 1);
+    EXPECT_EQ(myVec[0], 4);
+}
+
+TEST(Utilities, PushBackAfterMove)
+{
+    VectorLite<int> myVec({1, 2, 3});
+    VectorLite<int> other(std::move(myVec));
+    myVec.push_back(4);
+    EXPECT_EQ(myVec.size(), 1);
+    EXPECT_EQ(myVec[0], 4);
+    EXPECT_EQ(other.size(), 3);
+}
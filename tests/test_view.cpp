@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+#include "VectorLiteView.h"
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+static VectorLite<int> iota_vector(int n)
+{
+    VectorLite<int> vec;
+    for (int i = 0; i < n; ++i) {
+        vec.push_back(i);
+    }
+    return vec;
+}
+
+TEST(View, WholeVector_SharesStorage) {
+    VectorLite<int> vec = iota_vector(10);
+    VectorLiteView<int> view(vec);
+    EXPECT_EQ(view.size(), 10);
+    EXPECT_EQ(view.data(), vec.data());
+    EXPECT_TRUE(view.contiguous());
+
+    view[3] = 42;
+    EXPECT_EQ(vec[3], 42);
+}
+
+TEST(View, Subview_OffsetsWithoutCopying) {
+    VectorLite<int> vec = iota_vector(10);
+    VectorLiteView<int> mid = VectorLiteView<int>(vec).subview(2, 5);
+    EXPECT_EQ(mid.size(), 5);
+    EXPECT_EQ(mid.data(), vec.data() + 2);
+    EXPECT_EQ(mid.front(), 2);
+    EXPECT_EQ(mid.back(), 6);
+
+    VectorLiteView<int> inner = mid.subview(1, 2);
+    EXPECT_EQ(inner[0], 3);
+    EXPECT_EQ(inner[1], 4);
+    EXPECT_EQ(mid.first(2)[1], 3);
+    EXPECT_EQ(mid.last(2)[0], 5);
+    EXPECT_TRUE(mid.subview(5, 0).empty());
+}
+
+TEST(View, Subview_OutOfBoundsThrows) {
+    VectorLite<int> vec = iota_vector(4);
+    VectorLiteView<int> view(vec);
+    EXPECT_THROW(view.subview(3, 2), std::out_of_range);
+    EXPECT_THROW(view.subview(5, 0), std::out_of_range);
+    EXPECT_THROW(view.last(5), std::out_of_range);
+    EXPECT_THROW(view.at(4), std::out_of_range);
+}
+
+TEST(View, Strided_EveryNthElement) {
+    VectorLite<int> vec = iota_vector(10);
+    VectorLiteView<int> evens = VectorLiteView<int>(vec).strided(2);
+    EXPECT_EQ(evens.size(), 5);
+    EXPECT_FALSE(evens.contiguous());
+    for (size_t i = 0; i < evens.size(); ++i) {
+        EXPECT_EQ(evens[i], static_cast<int>(2 * i));
+    }
+
+    VectorLiteView<int> sixes = evens.strided(3);
+    EXPECT_EQ(sixes.size(), 2);
+    EXPECT_EQ(sixes[1], 6);
+
+    VectorLiteView<int> tail = evens.subview(1, 3);
+    EXPECT_EQ(tail[0], 2);
+    EXPECT_EQ(tail.back(), 6);
+    EXPECT_THROW(evens.strided(0), std::invalid_argument);
+}
+
+TEST(View, Iterators_FollowStride) {
+    VectorLite<int> vec = iota_vector(9);
+    int expected = 0;
+    for (int& value : VectorLiteView<int>(vec).strided(3)) {
+        EXPECT_EQ(value, expected);
+        value = -1;
+        expected += 3;
+    }
+    EXPECT_EQ(expected, 9);
+    EXPECT_EQ(vec[3], -1);
+    EXPECT_EQ(vec[4], 4);
+}
+
+TEST(View, StridedEnd_StaysInsideTheBuffer) {
+    VectorLite<int> vec = iota_vector(10);
+    VectorLiteView<int> fours = VectorLiteView<int>(vec).strided(4); // 0, 4, 8; a stride past 8 is 12
+    VectorLite<int> seen;
+    for (auto it = fours.begin(); it != fours.end(); ++it) {
+        seen.push_back(*it);
+    }
+    EXPECT_TRUE(seen == VectorLite<int>({0, 4, 8}));
+
+    VectorLiteView<int> emptyTail = fours.last(0);
+    EXPECT_TRUE(emptyTail.empty());
+    EXPECT_LE(emptyTail.data(), vec.data() + vec.size());
+    EXPECT_TRUE(emptyTail.begin() == emptyTail.end());
+}
+
+TEST(View, ConstView_FromConstVectorAndMutableView) {
+    const VectorLite<std::string> words({"a", "b", "c"});
+    VectorLiteView<const std::string> view(words);
+    EXPECT_EQ(view[2], "c");
+
+    VectorLite<int> vec = iota_vector(3);
+    VectorLiteView<int> mutableView(vec);
+    VectorLiteView<const int> readOnly = mutableView;
+    EXPECT_EQ(readOnly.data(), vec.data());
+}
+
+TEST(View, ToVector_CopiesStridedElements) {
+    VectorLite<int> vec = iota_vector(7);
+    VectorLite<int> odds = VectorLiteView<int>(vec).subview(1, 6).strided(2).to_vector();
+    EXPECT_TRUE(odds == VectorLite<int>({1, 3, 5}));
+    odds[0] = 100;
+    EXPECT_EQ(vec[1], 1);
+}
+
+TEST(Ownership, Data_PointsAtElements) {
+    VectorLite<int> vec({4, 5, 6});
+    EXPECT_EQ(vec.data(), &vec[0]);
+    const VectorLite<int>& ref = vec;
+    EXPECT_EQ(ref.data()[2], 6);
+}
+
+TEST(Ownership, Adopt_CallsDeleterOnDestruction) {
+    int calls = 0;
+    size_t freedCapacity = 0;
+    {
+        int* raw = static_cast<int*>(std::malloc(8 * sizeof(int)));
+        for (int i = 0; i < 8; ++i) {
+            raw[i] = i * 10;
+        }
+        VectorLite<int> vec = VectorLite<int>::adopt(raw, 5, 8, [&](int* ptr, size_t capacity) {
+            ++calls;
+            freedCapacity = capacity;
+            std::free(ptr);
+        });
+        EXPECT_EQ(vec.data(), raw);
+        EXPECT_EQ(vec.size(), 5);
+        EXPECT_EQ(vec.capacity(), 8);
+        EXPECT_EQ(vec[4], 40);
+        vec.push_back(50);
+        EXPECT_EQ(vec.data(), raw);
+        EXPECT_EQ(calls, 0);
+    }
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(freedCapacity, 8);
+}
+
+TEST(Ownership, Adopt_GrowthHandsOldBufferToDeleter) {
+    int calls = 0;
+    int* raw = new int[2]{1, 2};
+    VectorLite<int> vec = VectorLite<int>::adopt(raw, 2, 2, [&](int* ptr) {
+        ++calls;
+        delete[] ptr;
+    });
+    vec.push_back(3);
+    EXPECT_EQ(calls, 1);
+    EXPECT_NE(vec.data(), raw);
+    EXPECT_TRUE(vec == VectorLite<int>({1, 2, 3}));
+}
+
+TEST(Ownership, Adopt_SwapAndMoveCarryTheDeleter) {
+    int calls = 0;
+    auto deleter = [&](int* ptr) { ++calls; delete[] ptr; };
+    VectorLite<int> adopted = VectorLite<int>::adopt(new int[4]{}, 0, 4, deleter);
+    VectorLite<int> plain({7});
+    swap(adopted, plain);
+    EXPECT_EQ(calls, 0);
+
+    VectorLite<int> moved(std::move(plain));
+    plain = VectorLite<int>();
+    EXPECT_EQ(calls, 0);
+    moved.clear();
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(Ownership, Adopt_RejectsBadArguments) {
+    int buffer[4] = {};
+    auto noop = [](int*) {};
+    EXPECT_THROW(VectorLite<int>::adopt(buffer, 5, 4, noop), std::invalid_argument);
+    EXPECT_THROW(VectorLite<int>::adopt(nullptr, 0, 4, noop), std::invalid_argument);
+}
+
+TEST(Ownership, Release_LeavesEmptyVectorAndUsableBuffer) {
+    VectorLite<std::string> vec({"x", "y", "z"});
+    std::string* raw = vec.data();
+    VectorLiteBuffer<std::string> buf = vec.release();
+
+    EXPECT_EQ(buf.ptr, raw);
+    EXPECT_EQ(buf.size, 3);
+    EXPECT_EQ(buf.ptr[1], "y");
+    EXPECT_EQ(vec.size(), 0);
+    EXPECT_EQ(vec.data(), nullptr);
+
+    vec.push_back("again");
+    EXPECT_EQ(vec[0], "again");
+    buf.deleter(buf.ptr, buf.capacity);
+}
+
+TEST(Ownership, ReleaseThenAdopt_RoundTripsWithoutCopy) {
+    VectorLite<int> vec(16, VectorLiteAllocOptions::cache_aligned());
+    vec.push_back(1);
+    vec.push_back(2);
+    int* raw = vec.data();
+
+    VectorLite<int> back = VectorLite<int>::adopt(vec.release());
+    EXPECT_EQ(back.data(), raw);
+    EXPECT_EQ(back.capacity(), 16);
+    EXPECT_EQ(back.alloc_options().alignment, 64);
+    EXPECT_TRUE(back == VectorLite<int>({1, 2}));
+
+    int calls = 0;
+    VectorLite<int> custom = VectorLite<int>::adopt(new int[3]{}, 3, 3, [&](int* ptr) { ++calls; delete[] ptr; });
+    VectorLite<int> again = VectorLite<int>::adopt(custom.release());
+    EXPECT_EQ(calls, 0);
+    again.clear();
+    EXPECT_EQ(calls, 1);
+}